@@ -108,6 +108,23 @@ impl Cli {
         opts.optflag("", "window", "Start the game in a window");
         opts.optflag("", "debug", "Enable Debug Mode");
         opts.optflag("", "enumgen", "Generate enums for Lua and exit");
+        opts.optopt(
+            "",
+            "record",
+            "Record the input events of the session to a file",
+            "FILE",
+        );
+        opts.optopt(
+            "",
+            "replay",
+            "Play back the input events recorded to a file and log a run summary",
+            "FILE",
+        );
+        opts.optflag(
+            "",
+            "maxspeed",
+            "Play back the recorded input without limiting the frame rate",
+        );
         opts.optflag("h", "help", "print this help menu");
 
         Cli {
@@ -216,6 +233,18 @@ impl Cli {
                     engine_options.run_enum_gen = true;
                 }
 
+                if let Some(s) = m.opt_str("record") {
+                    engine_options.record_input_file = PathBuf::from(s);
+                }
+
+                if let Some(s) = m.opt_str("replay") {
+                    engine_options.replay_input_file = PathBuf::from(s);
+                }
+
+                if m.opt_present("maxspeed") {
+                    engine_options.replay_at_max_speed = true;
+                }
+
                 Ok(())
             }
             Err(f) => Err(CliError::ParsingFailed(f.to_string())),
@@ -317,6 +346,27 @@ mod tests {
         assert_eq!(engine_options.mods[1], "ö");
     }
 
+    #[test]
+    fn apply_to_engine_options_should_set_input_recording_options() {
+        let mut engine_options = EngineOptions::default();
+        let input = Cli::from_args(&[
+            String::from("ja2"),
+            String::from("--replay"),
+            String::from("firefight.rec"),
+            String::from("--maxspeed"),
+        ]);
+        assert_eq!(
+            input.apply_to_engine_options(&mut engine_options).err(),
+            None
+        );
+        assert_eq!(engine_options.record_input_file, PathBuf::from(""));
+        assert_eq!(
+            engine_options.replay_input_file,
+            PathBuf::from("firefight.rec")
+        );
+        assert!(engine_options.replay_at_max_speed);
+    }
+
     #[test]
     fn apply_to_engine_options_should_fail_with_unknown_resversion() {
         let mut engine_options = EngineOptions::default();
@@ -81,6 +81,12 @@ pub struct EngineOptions {
     pub start_without_sound: bool,
     /// Whether to enum-gen for Lua
     pub run_enum_gen: bool,
+    /// File to record the input events of the session to, empty if not recording
+    pub record_input_file: PathBuf,
+    /// File with recorded input events to play back, empty if not replaying
+    pub replay_input_file: PathBuf,
+    /// Whether to play back the recorded input without a frame rate limit
+    pub replay_at_max_speed: bool,
 }
 
 impl Default for EngineOptions {
@@ -103,6 +109,9 @@ impl Default for EngineOptions {
             start_in_debug_mode: false,
             start_without_sound: false,
             run_enum_gen: false,
+            record_input_file: PathBuf::from(""),
+            replay_input_file: PathBuf::from(""),
+            replay_at_max_speed: false,
         }
     }
 }
@@ -8,6 +8,9 @@
 
 use std::path::{Path, PathBuf};
 use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::mpsc::{sync_channel, Receiver, SyncSender, TrySendError};
+use std::sync::{Arc, Mutex};
+use std::thread;
 
 use log::{
     logger, set_boxed_logger, set_max_level, Level, LevelFilter, Log, Metadata, MetadataBuilder,
@@ -16,6 +19,9 @@ use log::{
 
 static GLOBAL_LOG_LEVEL: AtomicUsize = AtomicUsize::new(LogLevel::Info as usize);
 
+/// Number of records that can be queued for the writer thread
+const QUEUE_CAPACITY: usize = 4096;
+
 #[derive(Debug, PartialEq, Eq, Copy, Clone)]
 #[repr(C)]
 /// Enum to represent log levels in the application
@@ -115,6 +121,143 @@ impl Log for RuntimeLevelFilter {
     }
 }
 
+/// Owned copy of a log record, so it can be passed to the writer thread
+struct QueuedRecord {
+    level: Level,
+    target: String,
+    module_path: Option<String>,
+    file: Option<String>,
+    line: Option<u32>,
+    thread: String,
+    message: String,
+}
+
+enum Command {
+    Log(QueuedRecord),
+    Flush(SyncSender<()>),
+}
+
+/// Logger that hands records to a writer thread instead of writing them itself
+///
+/// Writing to the terminal and the log file happens on the writer thread.
+/// When the queue is full, records are dropped and counted instead of blocking the
+/// caller. Errors are never dropped and are written before the caller continues.
+struct AsyncLogger {
+    sender: Mutex<SyncSender<Command>>,
+    dropped: Arc<AtomicUsize>,
+}
+
+impl AsyncLogger {
+    fn new(logger: Box<dyn Log>) -> AsyncLogger {
+        let (sender, receiver) = sync_channel(QUEUE_CAPACITY);
+        let dropped = Arc::new(AtomicUsize::new(0));
+        let writer_dropped = dropped.clone();
+        let spawned = thread::Builder::new()
+            .name("logger".to_owned())
+            .spawn(move || Self::write_records(logger, receiver, &writer_dropped));
+        if let Err(err) = spawned {
+            panic!("Failed to start the logger thread: {}", err);
+        }
+        AsyncLogger {
+            sender: Mutex::new(sender),
+            dropped,
+        }
+    }
+
+    fn write_records(logger: Box<dyn Log>, receiver: Receiver<Command>, dropped: &AtomicUsize) {
+        for command in receiver {
+            let dropped_count = dropped.swap(0, Ordering::Relaxed);
+            if dropped_count > 0 {
+                logger.log(
+                    &Record::builder()
+                        .level(Level::Warn)
+                        .target(module_path!())
+                        .args(format_args!(
+                            "Dropped {} log messages, the log queue was full",
+                            dropped_count
+                        ))
+                        .build(),
+                );
+            }
+            match command {
+                Command::Log(record) => {
+                    logger.log(
+                        &Record::builder()
+                            .level(record.level)
+                            .target(&record.target)
+                            .module_path(record.module_path.as_deref())
+                            .file(record.file.as_deref())
+                            .line(record.line)
+                            .args(format_args!("({}) {}", record.thread, record.message))
+                            .build(),
+                    );
+                }
+                Command::Flush(done) => {
+                    logger.flush();
+                    let _ = done.send(());
+                }
+            }
+        }
+    }
+
+    fn send(&self, command: Command, block: bool) -> bool {
+        let sender = match self.sender.lock() {
+            Ok(sender) => sender,
+            Err(poisoned) => poisoned.into_inner(),
+        };
+        if block {
+            sender.send(command).is_ok()
+        } else {
+            match sender.try_send(command) {
+                Ok(()) => true,
+                Err(TrySendError::Full(_)) => {
+                    self.dropped.fetch_add(1, Ordering::Relaxed);
+                    false
+                }
+                Err(TrySendError::Disconnected(_)) => false,
+            }
+        }
+    }
+}
+
+impl Log for AsyncLogger {
+    fn enabled(&self, _metadata: &Metadata) -> bool {
+        true
+    }
+
+    fn log(&self, record: &Record) {
+        let current = thread::current();
+        let thread = match current.name() {
+            Some(name) => name.to_owned(),
+            None => format!("{:?}", current.id()),
+        };
+        let queued = QueuedRecord {
+            level: record.level(),
+            target: record.target().to_owned(),
+            module_path: record.module_path().map(str::to_owned),
+            file: record.file().map(str::to_owned),
+            line: record.line(),
+            thread,
+            message: record.args().to_string(),
+        };
+        if record.level() == Level::Error {
+            // Errors might be the last thing that gets logged before the game exits
+            if self.send(Command::Log(queued), true) {
+                self.flush();
+            }
+        } else {
+            self.send(Command::Log(queued), false);
+        }
+    }
+
+    fn flush(&self) {
+        let (done, wait) = sync_channel(1);
+        if self.send(Command::Flush(done), true) {
+            let _ = wait.recv();
+        }
+    }
+}
+
 /// Convenience struct to group logging functionality
 pub struct Logger;
 
@@ -137,14 +280,15 @@ impl Logger {
         use log::warn;
         use simplelog::{
             ColorChoice, CombinedLogger, ConfigBuilder, SharedLogger, TermLogger, TerminalMode,
-            ThreadLogMode, WriteLogger,
+            WriteLogger,
         };
         use std::fs::File;
 
         let log_file = Self::get_log_file_path(log_file_name);
         let mut config = ConfigBuilder::default();
         config.set_target_level(LevelFilter::Error);
-        config.set_thread_mode(ThreadLogMode::IDs);
+        // The writer thread adds the name of the logging thread to the message itself
+        config.set_thread_level(LevelFilter::Off);
         config.set_time_format_rfc3339();
         let config = config.build();
         let logger: Box<dyn SharedLogger> = TermLogger::new(
@@ -156,14 +300,16 @@ impl Logger {
 
         match File::create(&log_file) {
             Ok(f) => {
-                RuntimeLevelFilter::init(CombinedLogger::new(vec![
+                RuntimeLevelFilter::init(Box::new(AsyncLogger::new(CombinedLogger::new(vec![
                     logger,
                     WriteLogger::new(LevelFilter::max(), config, f),
-                ]));
+                ]))));
                 log::info!("Logging to file {:?}", &log_file);
             }
             Err(err) => {
-                RuntimeLevelFilter::init(CombinedLogger::new(vec![logger]));
+                RuntimeLevelFilter::init(Box::new(AsyncLogger::new(CombinedLogger::new(vec![
+                    logger,
+                ]))));
                 warn!("Failed to log to {:?}: {}", &log_file, err);
             }
         }
@@ -179,6 +325,13 @@ impl Logger {
         RuntimeLevelFilter::get_global_log_level().into()
     }
 
+    /// Waits until all queued log messages have been written
+    ///
+    /// Needs to be called before the game exits, otherwise messages might be lost.
+    pub fn flush() {
+        logger().flush()
+    }
+
     /// Logs message with specific metadata
     ///
     /// Can be used e.g. in C++ or scripting
@@ -57,6 +57,7 @@
 //! [(faq/casemap_charprop.html#2)]: http://unicode.org/faq/casemap_charprop.html#2
 #![allow(dead_code)]
 
+use std::borrow::Borrow;
 use std::fmt;
 use std::ops;
 
@@ -116,6 +117,13 @@ impl AsRef<str> for Nfc {
     }
 }
 
+/// Allows looking up normalized keys with a `&str` that is known to be normalized.
+impl Borrow<str> for Nfc {
+    fn borrow(&self) -> &str {
+        &self.inner
+    }
+}
+
 impl From<&str> for Nfc {
     fn from(s: &str) -> Self {
         Self::from(s.to_owned())
@@ -170,6 +170,41 @@ impl VfsLayer for DirFs {
 
         Ok(result)
     }
+
+    fn list_files(&self) -> io::Result<Vec<Nfc>> {
+        let mut result = Vec::new();
+        // The canonical paths of the directories above each pending one, so a
+        // symlink back to one of them does not send the walk round in circles
+        let mut pending = vec![(self.dir_path.clone(), String::new(), Vec::new())];
+
+        while let Some((dir, prefix, mut ancestors)) = pending.pop() {
+            let canonical = fs::canonicalize(&dir)?;
+            if ancestors.contains(&canonical) {
+                continue;
+            }
+            ancestors.push(canonical);
+
+            for entry in fs::read_dir(&dir)? {
+                let entry = entry?;
+                let file_name = entry.file_name().into_string().map_err(|err| {
+                    io::Error::new(
+                        io::ErrorKind::InvalidInput,
+                        format!("Could not convert path {:?} to NFC for DirFs", err),
+                    )
+                })?;
+                let file_path = format!("{}{}", prefix, file_name);
+                // Follow symlinks like `open` does
+                let path = entry.path();
+                if path.is_dir() {
+                    pending.push((path, format!("{}/", file_path), ancestors.clone()));
+                } else if path.is_file() {
+                    result.push(Nfc::caseless_path(&file_path));
+                }
+            }
+        }
+
+        Ok(result)
+    }
 }
 
 impl VfsFile for DirFsFile {
@@ -9,7 +9,7 @@ pub mod android;
 pub mod dir;
 pub mod slf;
 
-use std::collections::HashSet;
+use std::collections::{HashMap, HashSet};
 use std::fmt;
 use std::io;
 use std::io::ErrorKind;
@@ -58,6 +58,12 @@ pub trait VfsLayer: fmt::Debug + fmt::Display + Send + Sync {
             .filter(|path| path.ends_with(extension.as_str()))
             .collect())
     }
+    /// Lists all files in the VFS Layer for the path index of the VFS
+    ///
+    /// Layers that cannot list their files are not indexed and get asked on every open instead.
+    fn list_files(&self) -> io::Result<Vec<Nfc>> {
+        Err(io::ErrorKind::Unsupported.into())
+    }
 }
 
 /// A virtual filesystem that mounts other filesystems.
@@ -65,6 +71,41 @@ pub trait VfsLayer: fmt::Debug + fmt::Display + Send + Sync {
 pub struct Vfs {
     /// List of entries.
     pub entries: Vec<Arc<dyn VfsLayer + Send + Sync>>,
+    /// Merged path index of all entries, built by `init` and `rescan`.
+    index: Option<VfsIndex>,
+}
+
+/// Merged index of the files in all layers of a VFS.
+///
+/// Files that are added to a directory layer after the index was built are
+/// not found until the next `Vfs::rescan`.
+#[derive(Debug, Default)]
+struct VfsIndex {
+    /// Position of the layer with the highest priority for each file.
+    paths: HashMap<Nfc, usize>,
+    /// Positions of the layers that could not be listed.
+    unindexed: Vec<usize>,
+}
+
+/// Longest path that is normalized on the stack for an index lookup.
+const MAX_STACK_PATH_LEN: usize = 256;
+
+/// Normalizes a plain ASCII path like `Nfc::caseless_path` into `buf`.
+///
+/// Returns `None` if the path is not ASCII or does not fit.
+fn ascii_caseless_path<'a>(path: &str, buf: &'a mut [u8]) -> Option<&'a str> {
+    if !path.is_ascii() || path.len() > buf.len() {
+        return None;
+    }
+    let buf = &mut buf[..path.len()];
+    for (dst, src) in buf.iter_mut().zip(path.bytes()) {
+        *dst = if src == b'\\' {
+            b'/'
+        } else {
+            src.to_ascii_lowercase()
+        };
+    }
+    std::str::from_utf8(buf).ok()
 }
 
 /// A virtual filesystem that mounts other filesystems.
@@ -93,6 +134,7 @@ impl Vfs {
             error,
         })?;
         self.entries.push(dir_fs.clone());
+        self.index = None;
         Ok(dir_fs)
     }
 
@@ -101,6 +143,7 @@ impl Vfs {
         let path = PathBuf::from(format!("{}", file));
         let slf_fs = SlfFs::new(file).map_err(|error| VfsInitError { path, error })?;
         self.entries.push(slf_fs.clone());
+        self.index = None;
         Ok(slf_fs)
     }
 
@@ -113,6 +156,7 @@ impl Vfs {
                 error,
             })?;
         self.entries.push(asset_manager_fs.clone());
+        self.index = None;
         Ok(asset_manager_fs)
     }
 
@@ -262,12 +306,95 @@ impl Vfs {
             );
         }
 
+        self.rescan();
+
         Ok(())
     }
-}
 
-impl VfsLayer for Vfs {
-    fn open(&self, file_path: &Nfc) -> io::Result<Box<dyn VfsFile>> {
+    /// Rebuilds the merged path index from the files currently in all layers
+    pub fn rescan(&mut self) {
+        let mut index = VfsIndex::default();
+        for (position, entry) in self.entries.iter().enumerate() {
+            match entry.list_files() {
+                Ok(files) => {
+                    for file in files {
+                        index.paths.entry(file).or_insert(position);
+                    }
+                }
+                Err(err) => {
+                    if err.kind() != io::ErrorKind::Unsupported {
+                        warn!("Could not index {}: {}", entry, err);
+                    }
+                    index.unindexed.push(position);
+                }
+            }
+        }
+        info!(
+            "VFS index contains {} files, {} layers are not indexed",
+            index.paths.len(),
+            index.unindexed.len()
+        );
+        self.index = Some(index);
+    }
+
+    /// Opens a file by a path that is not normalized yet
+    ///
+    /// Plain ASCII paths are normalized on the stack and looked up in the
+    /// index without allocating.
+    pub fn open_path(&self, path: &str) -> io::Result<Box<dyn VfsFile>> {
+        if let Some(index) = &self.index {
+            let mut buf = [0u8; MAX_STACK_PATH_LEN];
+            if let Some(key) = ascii_caseless_path(path, &mut buf) {
+                match index.paths.get_key_value(key) {
+                    Some((file_path, &position)) => {
+                        return self.open_indexed(index, file_path, Some(position))
+                    }
+                    None if index.unindexed.is_empty() => {
+                        return Err(io::ErrorKind::NotFound.into())
+                    }
+                    None => {}
+                }
+            }
+        }
+        self.open(&Nfc::caseless_path(path))
+    }
+
+    /// Opens a file with the help of the index
+    ///
+    /// Layers without index that have a higher priority than the indexed one are asked first.
+    fn open_indexed(
+        &self,
+        index: &VfsIndex,
+        file_path: &Nfc,
+        position: Option<usize>,
+    ) -> io::Result<Box<dyn VfsFile>> {
+        let end = position.unwrap_or(self.entries.len());
+        for &unindexed in index.unindexed.iter().take_while(|&&i| i < end) {
+            let file_result = self.entries[unindexed].open(file_path);
+            if let Err(err) = &file_result {
+                if err.kind() == io::ErrorKind::NotFound {
+                    continue;
+                }
+            }
+            return file_result;
+        }
+        match position {
+            Some(position) => {
+                let file_result = self.entries[position].open(file_path);
+                if let Err(err) = &file_result {
+                    if err.kind() == io::ErrorKind::NotFound {
+                        // The file was removed since the index was built
+                        return self.open_unindexed(file_path);
+                    }
+                }
+                file_result
+            }
+            None => Err(io::ErrorKind::NotFound.into()),
+        }
+    }
+
+    /// Opens a file by asking each layer in turn
+    fn open_unindexed(&self, file_path: &Nfc) -> io::Result<Box<dyn VfsFile>> {
         for entry in self.entries.iter() {
             let file_result = entry.open(file_path);
             if let Err(err) = &file_result {
@@ -279,6 +406,18 @@ impl VfsLayer for Vfs {
         }
         Err(io::ErrorKind::NotFound.into())
     }
+}
+
+impl VfsLayer for Vfs {
+    fn open(&self, file_path: &Nfc) -> io::Result<Box<dyn VfsFile>> {
+        match &self.index {
+            Some(index) => {
+                let position = index.paths.get(file_path).copied();
+                self.open_indexed(index, file_path, position)
+            }
+            None => self.open_unindexed(file_path),
+        }
+    }
 
     fn read_dir(&self, file_path: &Nfc) -> io::Result<HashSet<Nfc>> {
         let mut entries = HashSet::new();
@@ -432,6 +571,55 @@ mod tests {
         vfs.init(&engine_options, &mod_manager).unwrap();
     }
 
+    #[test]
+    fn index_should_respect_priority_and_pick_up_new_files_on_rescan() {
+        use std::io::Read;
+
+        let temp_dir = tempdir().expect("temp_dir");
+        let high = temp_dir.path().join("high");
+        let low = temp_dir.path().join("low");
+        std::fs::create_dir_all(&high.join("Sub")).expect("create `high/Sub` dir");
+        std::fs::create_dir(&low).expect("create `low` dir");
+        std::fs::write(&high.join("Sub").join("Foo.txt"), b"high").expect("write `Foo.txt`");
+        std::fs::create_dir(&low.join("sub")).expect("create `low/sub` dir");
+        std::fs::write(&low.join("sub").join("foo.txt"), b"low").expect("write `foo.txt`");
+
+        let mut vfs = Vfs::new();
+        vfs.add_dir(&high).unwrap();
+        vfs.add_dir(&low).unwrap();
+        vfs.rescan();
+
+        let mut contents = String::new();
+        vfs.open_path("SUB\\foo.TXT")
+            .expect("open `SUB\\foo.TXT`")
+            .read_to_string(&mut contents)
+            .unwrap();
+        assert_eq!(contents, "high");
+
+        std::fs::write(&low.join("new.txt"), b"new").expect("write `new.txt`");
+        vfs.open_path("new.txt").unwrap_err();
+        vfs.rescan();
+        vfs.open_path("new.txt")
+            .expect("open `new.txt` after rescan");
+    }
+
+    #[cfg(unix)]
+    #[test]
+    fn index_should_not_follow_symlinks_back_to_a_parent_dir() {
+        let temp_dir = tempdir().expect("temp_dir");
+        let dir = temp_dir.path().join("dir");
+        std::fs::create_dir_all(&dir.join("sub")).expect("create `dir/sub` dir");
+        std::fs::write(&dir.join("sub").join("foo.txt"), b"foo").expect("write `foo.txt`");
+        std::os::unix::fs::symlink(&dir, &dir.join("sub").join("loop"))
+            .expect("create `loop` symlink");
+
+        let mut vfs = Vfs::new();
+        vfs.add_dir(&dir).unwrap();
+        vfs.rescan();
+
+        vfs.open_path("sub\\foo.txt").expect("open `sub\\foo.txt`");
+    }
+
     const EMPTY_SLF_BYTES: &[u8] = include_bytes!("test_fixtures/empty.slf");
 
     fn create_test_engine_options() -> (EngineOptions, TempDir) {
@@ -130,6 +130,10 @@ impl VfsLayer for SlfFs {
             Ok(entries)
         }
     }
+
+    fn list_files(&self) -> io::Result<Vec<Nfc>> {
+        Ok(self.entries.keys().cloned().collect())
+    }
 }
 
 impl VfsFile for SlfFsFile {
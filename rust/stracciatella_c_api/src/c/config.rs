@@ -231,6 +231,31 @@ pub extern "C" fn EngineOptions_setResourceVersion(ptr: *mut EngineOptions, res:
     engine_options.resource_version = res;
 }
 
+/// Gets the `EngineOptions.record_input_file` path, empty if not recording.
+/// The caller is responsible for the returned memory.
+#[no_mangle]
+pub extern "C" fn EngineOptions_getRecordInputFile(ptr: *const EngineOptions) -> *mut c_char {
+    let engine_options = unsafe_ref(ptr);
+    let record_input_file = c_string_from_path_or_panic(&engine_options.record_input_file);
+    record_input_file.into_raw()
+}
+
+/// Gets the `EngineOptions.replay_input_file` path, empty if not replaying.
+/// The caller is responsible for the returned memory.
+#[no_mangle]
+pub extern "C" fn EngineOptions_getReplayInputFile(ptr: *const EngineOptions) -> *mut c_char {
+    let engine_options = unsafe_ref(ptr);
+    let replay_input_file = c_string_from_path_or_panic(&engine_options.replay_input_file);
+    replay_input_file.into_raw()
+}
+
+/// Gets `EngineOptions.replay_at_max_speed`.
+#[no_mangle]
+pub extern "C" fn EngineOptions_shouldReplayAtMaxSpeed(ptr: *const EngineOptions) -> bool {
+    let engine_options = unsafe_ref(ptr);
+    engine_options.replay_at_max_speed
+}
+
 /// Gets `EngineOptions.run_unittests`.
 #[no_mangle]
 pub extern "C" fn EngineOptions_shouldRunUnittests(ptr: *const EngineOptions) -> bool {
@@ -4,7 +4,77 @@ use json_patch::{patch, Patch};
 use serde_json::{from_value, Value};
 use stracciatella::json::de;
 
-use super::{common::*, vec::VecCString};
+use super::{
+    common::*,
+    vec::{VecCString, VecU8},
+};
+
+/// Tags of the flat encoding produced by `RJsonValue_encode`.
+///
+/// Every value starts with its tag. Integers and doubles follow as 8 bytes,
+/// strings as a `u32` length and the UTF-8 bytes, arrays as a `u32` count and
+/// the elements, objects as a `u32` count and key/value pairs sorted by key.
+/// All numbers are little endian.
+const ENCODED_NULL: u8 = 0;
+const ENCODED_FALSE: u8 = 1;
+const ENCODED_TRUE: u8 = 2;
+const ENCODED_INT: u8 = 3;
+const ENCODED_UINT: u8 = 4;
+const ENCODED_DOUBLE: u8 = 5;
+const ENCODED_STRING: u8 = 6;
+const ENCODED_ARRAY: u8 = 7;
+const ENCODED_OBJECT: u8 = 8;
+
+fn encode_len(len: usize, out: &mut Vec<u8>) {
+    out.extend_from_slice(&(len as u32).to_le_bytes());
+}
+
+fn encode_str(s: &str, out: &mut Vec<u8>) {
+    encode_len(s.len(), out);
+    out.extend_from_slice(s.as_bytes());
+}
+
+fn encode_value(value: &Value, out: &mut Vec<u8>) {
+    match value {
+        Value::Null => out.push(ENCODED_NULL),
+        Value::Bool(false) => out.push(ENCODED_FALSE),
+        Value::Bool(true) => out.push(ENCODED_TRUE),
+        Value::Number(n) => {
+            if let Some(i) = n.as_i64() {
+                out.push(ENCODED_INT);
+                out.extend_from_slice(&i.to_le_bytes());
+            } else if let Some(u) = n.as_u64() {
+                out.push(ENCODED_UINT);
+                out.extend_from_slice(&u.to_le_bytes());
+            } else {
+                out.push(ENCODED_DOUBLE);
+                out.extend_from_slice(&n.as_f64().unwrap_or_default().to_le_bytes());
+            }
+        }
+        Value::String(s) => {
+            out.push(ENCODED_STRING);
+            encode_str(s, out);
+        }
+        Value::Array(arr) => {
+            out.push(ENCODED_ARRAY);
+            encode_len(arr.len(), out);
+            for v in arr {
+                encode_value(v, out);
+            }
+        }
+        Value::Object(obj) => {
+            out.push(ENCODED_OBJECT);
+            encode_len(obj.len(), out);
+            // Same order as the keys of RJsonObject
+            let mut entries: Vec<_> = obj.iter().collect();
+            entries.sort_by(|a, b| a.0.cmp(b.0));
+            for (k, v) in entries {
+                encode_str(k, out);
+                encode_value(v, out);
+            }
+        }
+    }
+}
 
 #[derive(Debug, Clone)]
 pub struct RJsonValue(pub Value);
@@ -99,6 +169,12 @@ impl RJsonValue {
     fn is_string(&self) -> bool {
         self.0.is_string()
     }
+
+    fn encode(&self) -> Vec<u8> {
+        let mut out = Vec::new();
+        encode_value(&self.0, &mut out);
+        out
+    }
 }
 
 impl<T> From<T> for RJsonValue
@@ -348,6 +424,15 @@ pub extern "C" fn RJsonValue_isBool(value: *const RJsonValue) -> bool {
     is_type!(value, is_bool)
 }
 
+/// Encodes the whole JSON value into a flat buffer, so it can be read
+/// without calling back for every element.
+/// coverity[+alloc]
+#[no_mangle]
+pub extern "C" fn RJsonValue_encode(value: *const RJsonValue) -> *mut VecU8 {
+    let value = unsafe_ref(value);
+    into_ptr(VecU8::from(value.encode()))
+}
+
 /// Serializes the JSON value to a string.
 #[no_mangle]
 pub extern "C" fn RJsonValue_serialize(value: *const RJsonValue, pretty: bool) -> *mut c_char {
@@ -471,3 +556,22 @@ pub extern "C" fn RJsonObject_toValue(obj: *const RJsonObject) -> *mut RJsonValu
     let obj = unsafe_ref(obj);
     into_ptr(obj.to_value())
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn encode_should_sort_object_keys() {
+        let value = RJsonValue::deserialize(r#"{"b": [1, -2.5], "a": "x"}"#).unwrap();
+        let mut expected = vec![ENCODED_OBJECT, 2, 0, 0, 0];
+        expected.extend_from_slice(&[1, 0, 0, 0, b'a', ENCODED_STRING, 1, 0, 0, 0, b'x']);
+        expected.extend_from_slice(&[1, 0, 0, 0, b'b', ENCODED_ARRAY, 2, 0, 0, 0]);
+        expected.push(ENCODED_INT);
+        expected.extend_from_slice(&1i64.to_le_bytes());
+        expected.push(ENCODED_DOUBLE);
+        expected.extend_from_slice(&(-2.5f64).to_le_bytes());
+
+        assert_eq!(value.encode(), expected);
+    }
+}
@@ -34,6 +34,12 @@ pub extern "C" fn Logger_getLevel() -> LogLevel {
     Logger::get_level()
 }
 
+/// Wait until all queued log messages have been written
+#[no_mangle]
+pub extern "C" fn Logger_flush() {
+    Logger::flush()
+}
+
 /// Log with custom metadata
 #[no_mangle]
 pub extern "C" fn Logger_log(level: LogLevel, message: *const c_char, target: *const c_char) {
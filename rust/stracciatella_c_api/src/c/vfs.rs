@@ -58,6 +58,14 @@ pub extern "C" fn Vfs_addDir(vfs: *mut Vfs, path: *const c_char) -> bool {
     no_rust_error()
 }
 
+/// Rebuilds the path index of the VFS, so files that were written to a
+/// directory layer since the last scan can be opened.
+#[no_mangle]
+pub extern "C" fn Vfs_rescan(vfs: *mut Vfs) {
+    let vfs = unsafe_mut(vfs);
+    vfs.rescan();
+}
+
 /// Lists a directory in the VFS with an optional filter on the extension (pass null otherwise).
 /// Returns a list of files on success and null otherwise
 /// Sets the rust error.
@@ -104,7 +112,7 @@ pub extern "C" fn VfsFile_open(vfs: *mut Vfs, path: *const c_char) -> *mut VFile
     forget_rust_error();
     let vfs = unsafe_mut(vfs);
     let path = str_from_c_str_or_panic(unsafe_c_str(path));
-    match vfs.open(&Nfc::caseless_path(path)) {
+    match vfs.open_path(path) {
         Err(err) => {
             remember_rust_error(format!("VfsFile_open {:?}: {}", path, err));
             std::ptr::null_mut()
@@ -91,6 +91,9 @@ public:
 	/* Checks if a game resource exists. */
 	virtual bool doesGameResExists(const ST::string& filename) const = 0;
 
+	/* Picks up game resources that were written after the resources were indexed. */
+	virtual void rescanGameResources() = 0;
+
 	/** User private file (e.g. settings) */
 	virtual DirFs* userPrivateFiles() const = 0;
 
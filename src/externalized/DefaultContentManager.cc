@@ -335,6 +335,12 @@ bool DefaultContentManager::doesGameResExists(const ST::string& filename) const
 	return static_cast<bool>(vfile.get());
 }
 
+/* Rebuilds the path index of the VFS, e.g. after the editor saved a map. */
+void DefaultContentManager::rescanGameResources()
+{
+	Vfs_rescan(m_vfs.get());
+}
+
 DirFs *DefaultContentManager::tempFiles() const
 {
 	return m_tempFiles.get();
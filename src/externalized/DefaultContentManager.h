@@ -66,6 +66,9 @@ public:
 	/* Checks if a game resource exists. */
 	virtual bool doesGameResExists(const ST::string& filename) const override;
 
+	/* Picks up game resources that were written after the resources were indexed. */
+	virtual void rescanGameResources() override;
+
 	/** Load encrypted string from game resource file. */
 	virtual ST::string loadEncryptedString(const ST::string& fileName, uint32_t seek_chars, uint32_t read_chars) const override;
 
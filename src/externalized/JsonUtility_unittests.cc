@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 
+#include "Json.h"
 #include "JsonUtility.h"
 
 TEST(JsonUtilityTest, parseListOfStrings)
@@ -31,3 +32,34 @@ TEST(JsonUtilityTest, parseListOfStrings)
 		ASSERT_STREQ(strings[1].c_str(), "bar");
 	}
 }
+
+TEST(JsonTest, readDeserializedDocument)
+{
+	auto json = JsonValue::deserialize(R"({"b": [1, -2.5, "x"], "a": {"c": true}, "d": 4294967296})");
+	auto obj = json.toObject();
+
+	auto keys = obj.keys();
+	ASSERT_EQ(keys.size(), 3u);
+	ASSERT_STREQ(keys[0].c_str(), "a");
+	ASSERT_STREQ(keys[2].c_str(), "d");
+
+	auto vec = obj["b"].toVec();
+	ASSERT_EQ(vec.size(), 3u);
+	ASSERT_EQ(vec[0].toInt(), 1);
+	ASSERT_TRUE(vec[1].isDouble());
+	ASSERT_EQ(vec[1].toDouble(), -2.5);
+	ASSERT_EQ(vec[0].toDouble(), 1.0);
+	ASSERT_STREQ(vec[2].toString().c_str(), "x");
+	EXPECT_THROW(vec[2].toInt(), std::runtime_error);
+
+	ASSERT_TRUE(obj.GetValue("a").toObject().GetBool("c"));
+	ASSERT_FALSE(obj.has("c"));
+	EXPECT_THROW(obj.GetValue("c"), std::runtime_error);
+	ASSERT_EQ(obj.getOptionalInt("c", 7), 7);
+
+	// Parts of the document can be handed back to Rust
+	ASSERT_STREQ(obj["b"].serialize().c_str(), "[1,-2.5,\"x\"]");
+	obj.set("e", JsonValue(5));
+	ASSERT_EQ(obj.GetInt("e"), 5);
+	ASSERT_TRUE(obj.GetValue("a").toObject().GetBool("c"));
+}
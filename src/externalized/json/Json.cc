@@ -2,27 +2,247 @@
 
 #include "string_theory/format"
 
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+
+namespace
+{
+// Tags of the encoding written by RJsonValue_encode
+enum EncodedTag : uint8_t
+{
+	ENCODED_NULL,
+	ENCODED_FALSE,
+	ENCODED_TRUE,
+	ENCODED_INT,
+	ENCODED_UINT,
+	ENCODED_DOUBLE,
+	ENCODED_STRING,
+	ENCODED_ARRAY,
+	ENCODED_OBJECT
+};
+
+class JsonDecoder
+{
+	public:
+		JsonDecoder(const uint8_t* data, size_t size, JsonDocument& doc) : m_pos(data), m_end(data + size), m_doc(doc) {}
+
+		void value(uint32_t idx)
+		{
+			uint8_t const tag = u8();
+			switch (tag)
+			{
+				case ENCODED_NULL:
+					m_doc.nodes[idx].kind = JsonDocument::Null;
+					break;
+				case ENCODED_FALSE:
+				case ENCODED_TRUE:
+					m_doc.nodes[idx].kind = JsonDocument::Bool;
+					m_doc.nodes[idx].b    = tag == ENCODED_TRUE;
+					break;
+				case ENCODED_INT:
+					m_doc.nodes[idx].kind = JsonDocument::Int;
+					m_doc.nodes[idx].i    = static_cast<int64_t>(u64());
+					break;
+				case ENCODED_UINT:
+					m_doc.nodes[idx].kind = JsonDocument::UInt;
+					m_doc.nodes[idx].u    = u64();
+					break;
+				case ENCODED_DOUBLE:
+				{
+					uint64_t const bits = u64();
+					m_doc.nodes[idx].kind = JsonDocument::Double;
+					memcpy(&m_doc.nodes[idx].d, &bits, sizeof(bits));
+					break;
+				}
+				case ENCODED_STRING:
+					m_doc.nodes[idx].kind = JsonDocument::String;
+					str(m_doc.nodes[idx].first, m_doc.nodes[idx].count);
+					break;
+				case ENCODED_ARRAY:
+				case ENCODED_OBJECT:
+				{
+					uint32_t const n     = u32();
+					uint32_t const first = static_cast<uint32_t>(m_doc.nodes.size());
+					m_doc.nodes.resize(first + n);
+					m_doc.nodes[idx].kind  = tag == ENCODED_ARRAY ? JsonDocument::Array : JsonDocument::Object;
+					m_doc.nodes[idx].first = first;
+					m_doc.nodes[idx].count = n;
+					for (uint32_t i = 0; i < n; ++i)
+					{
+						if (tag == ENCODED_OBJECT)
+						{
+							str(m_doc.nodes[first + i].keyOffset, m_doc.nodes[first + i].keyLength);
+						}
+						value(first + i);
+					}
+					break;
+				}
+				default:
+					throw std::runtime_error(ST::format("invalid JSON encoding tag {}", tag).c_str());
+			}
+		}
+
+	private:
+		void need(size_t n)
+		{
+			if (static_cast<size_t>(m_end - m_pos) < n)
+			{
+				throw std::runtime_error("truncated JSON encoding");
+			}
+		}
+
+		uint8_t u8()
+		{
+			need(1);
+			return *m_pos++;
+		}
+
+		uint32_t u32()
+		{
+			need(4);
+			uint32_t v = 0;
+			for (int i = 0; i < 4; ++i) v |= uint32_t(m_pos[i]) << (8 * i);
+			m_pos += 4;
+			return v;
+		}
+
+		uint64_t u64()
+		{
+			need(8);
+			uint64_t v = 0;
+			for (int i = 0; i < 8; ++i) v |= uint64_t(m_pos[i]) << (8 * i);
+			m_pos += 8;
+			return v;
+		}
+
+		void str(uint32_t& offset, uint32_t& length)
+		{
+			length = u32();
+			need(length);
+			offset = static_cast<uint32_t>(m_doc.strings.size());
+			m_doc.strings.append(reinterpret_cast<const char*>(m_pos), length);
+			m_pos += length;
+		}
+
+		const uint8_t* m_pos;
+		const uint8_t* m_end;
+		JsonDocument&  m_doc;
+};
+
+ST::string NodeString(const JsonDocument& doc, uint32_t offset, uint32_t length)
+{
+	return ST::string::from_utf8(doc.strings.data() + offset, length, ST::assume_valid);
+}
+
+[[noreturn]] void ThrowExpected(const char* what)
+{
+	throw std::runtime_error(ST::format("expected {}", what).c_str());
+}
+}
+
+std::shared_ptr<const JsonDocument> JsonDocument::decode(const RJsonValue* value)
+{
+	RustPointer<VecU8> encoded(RJsonValue_encode(value));
+	auto doc = std::make_shared<JsonDocument>();
+	doc->nodes.resize(1);
+	JsonDecoder(VecU8_as_ptr(encoded.get()), VecU8_len(encoded.get()), *doc).value(0);
+	return doc;
+}
+
+const JsonDocument::Node* JsonDocument::find(const Node& object, const char* name) const
+{
+	std::string_view const key{name};
+	uint32_t lo = object.first;
+	uint32_t hi = object.first + object.count;
+	while (lo < hi)
+	{
+		uint32_t const mid = lo + (hi - lo) / 2;
+		Node const& n = nodes[mid];
+		int const cmp = std::string_view(strings.data() + n.keyOffset, n.keyLength).compare(key);
+		if (cmp == 0) return &n;
+		if (cmp < 0) lo = mid + 1; else hi = mid;
+	}
+	return nullptr;
+}
+
 JsonValue JsonValue::deserialize(const ST::string& str) {
 	auto r = RJsonValue_deserialize(str.c_str());
 	throwRustError(!r);
-	return JsonValue(r);
+	JsonValue v(r);
+	v.m_doc = JsonDocument::decode(r);
+	return v;
 }
 
 JsonValue JsonValue::deserialize(const ST::string& vanillaStr, const ST::string& patchStr) {
 	auto r = RJsonValue_deserializeWithPatch(vanillaStr.c_str(), patchStr.c_str());
 	throwRustError(!r);
-	return JsonValue(r);
+	JsonValue v(r);
+	v.m_doc = JsonDocument::decode(r);
+	return v;
+}
+
+const RJsonValue* JsonValue::get() const {
+	if (m_value) return m_value.get();
+
+	// Build the value on the Rust side again, this is only needed to pass a
+	// part of a deserialized document back to Rust
+	auto const& n = *node();
+	switch (n.kind) {
+		case JsonDocument::Null:
+			m_value.reset(RJsonValue_deserialize("null"));
+			break;
+		case JsonDocument::Bool:
+			m_value.reset(RJsonValue_fromBool(n.b));
+			break;
+		case JsonDocument::Int:
+			m_value.reset(RJsonValue_deserialize(ST::format("{}", n.i).c_str()));
+			break;
+		case JsonDocument::UInt:
+			m_value.reset(RJsonValue_deserialize(ST::format("{}", n.u).c_str()));
+			break;
+		case JsonDocument::Double:
+			m_value.reset(RJsonValue_fromDouble(n.d));
+			break;
+		case JsonDocument::String:
+			m_value.reset(RJsonValue_fromString(NodeString(*m_doc, n.first, n.count).c_str()));
+			break;
+		case JsonDocument::Array: {
+			JsonArray arr;
+			for (uint32_t i = 0; i < n.count; ++i) {
+				arr.push(JsonValue(m_doc, n.first + i));
+			}
+			m_value = std::move(arr.toValue().m_value);
+			break;
+		}
+		case JsonDocument::Object:
+			m_value = std::move(JsonObject(m_doc, m_node).toRust().toValue().m_value);
+			break;
+	}
+	throwRustError(!m_value);
+	return m_value.get();
 }
 
 bool JsonValue::isVec() const {
+	if (m_doc) return node()->kind == JsonDocument::Array;
 	return RJsonValue_isArray(m_value.get());
 }
 
 std::vector<JsonValue> JsonValue::toVec() const {
+	std::vector<JsonValue> vec;
+	if (m_doc) {
+		auto const& n = *node();
+		if (n.kind != JsonDocument::Array) ThrowExpected("array");
+		vec.reserve(n.count);
+		for (uint32_t i = 0; i < n.count; ++i) {
+			vec.emplace_back(m_doc, n.first + i);
+		}
+		return vec;
+	}
+
 	RustPointer<RJsonArray> array(RJsonValue_toArray(m_value.get()));
 	throwRustError(!array);
 	auto length = RJsonArray_length(array.get());
-	std::vector<JsonValue> vec;
 	vec.reserve(length);
 	for (size_t i = 0; i < length; i++) {
 		RustPointer<RJsonValue> val(RJsonArray_get(array.get(), i));
@@ -33,30 +253,49 @@ std::vector<JsonValue> JsonValue::toVec() const {
 }
 
 bool JsonValue::isObject() const {
+	if (m_doc) return node()->kind == JsonDocument::Object;
 	return RJsonValue_isObject(m_value.get());
 }
 
 JsonObject JsonValue::toObject() const {
+	if (m_doc) {
+		if (node()->kind != JsonDocument::Object) ThrowExpected("object");
+		return JsonObject(m_doc, m_node);
+	}
+
 	RustPointer<RJsonObject> obj(RJsonValue_toObject(m_value.get()));
 	throwRustError(!obj);
 	return JsonObject(obj.release());
 }
 
 bool JsonValue::isString() const {
+	if (m_doc) return node()->kind == JsonDocument::String;
 	return RJsonValue_isString(m_value.get());
 }
 
 ST::string JsonValue::toString() const {
+	if (m_doc) {
+		auto const& n = *node();
+		if (n.kind != JsonDocument::String) ThrowExpected("string");
+		return NodeString(*m_doc, n.first, n.count);
+	}
+
 	RustPointer<char> str(RJsonValue_toString(m_value.get()));
 	throwRustError(!str);
 	return str.get();
 }
 
 bool JsonValue::isInt() const {
+	if (m_doc) return node()->kind == JsonDocument::Int;
 	return RJsonValue_isInt(m_value.get());
 }
 
 int JsonValue::toInt() const {
+	if (m_doc) {
+		if (node()->kind != JsonDocument::Int) ThrowExpected("integer");
+		return node()->i;
+	}
+
 	bool success = false;
 	auto val = RJsonValue_toInt64(m_value.get(), &success);
 	throwRustError(!success);
@@ -67,6 +306,8 @@ bool JsonValue::isUInt() const {
 	if (!isInt()) {
 		return false;
 	}
+	if (m_doc) return node()->i >= 0;
+
 	bool success = false;
 	auto val = RJsonValue_toInt64(m_value.get(), &success);
 	throwRustError(!success);
@@ -75,9 +316,15 @@ bool JsonValue::isUInt() const {
 
 
 unsigned int JsonValue::toUInt() const {
-	bool success = false;
-	auto val = RJsonValue_toInt64(m_value.get(), &success);
-	throwRustError(!success);
+	int64_t val;
+	if (m_doc) {
+		if (node()->kind != JsonDocument::Int) ThrowExpected("integer");
+		val = node()->i;
+	} else {
+		bool success = false;
+		val = RJsonValue_toInt64(m_value.get(), &success);
+		throwRustError(!success);
+	}
 	if (val < 0) {
 		throw std::runtime_error(ST::format("expected uint, got {}", val).c_str());
 	}
@@ -85,10 +332,16 @@ unsigned int JsonValue::toUInt() const {
 }
 
 bool JsonValue::isBool() const {
+	if (m_doc) return node()->kind == JsonDocument::Bool;
 	return RJsonValue_isBool(m_value.get());
 }
 
 bool JsonValue::toBool() const {
+	if (m_doc) {
+		if (node()->kind != JsonDocument::Bool) ThrowExpected("boolean");
+		return node()->b;
+	}
+
 	bool success = false;
 	auto val = RJsonValue_toBool(m_value.get(), &success);
 	throwRustError(!success);
@@ -96,10 +349,21 @@ bool JsonValue::toBool() const {
 }
 
 bool JsonValue::isDouble() const {
+	if (m_doc) return node()->kind == JsonDocument::Double;
 	return RJsonValue_isDouble(m_value.get());
 }
 
 double JsonValue::toDouble() const {
+	if (m_doc) {
+		auto const& n = *node();
+		switch (n.kind) {
+			case JsonDocument::Int:    return static_cast<double>(n.i);
+			case JsonDocument::UInt:   return static_cast<double>(n.u);
+			case JsonDocument::Double: return n.d;
+			default:                   ThrowExpected("float");
+		}
+	}
+
 	bool success = false;
 	auto val = RJsonValue_toDouble(m_value.get(), &success);
 	throwRustError(!success);
@@ -125,11 +389,20 @@ JsonValue JsonArray::toValue() const {
 }
 
 ST::string JsonValue::serialize(bool pretty) const {
-	RustPointer<char> str(RJsonValue_serialize(m_value.get(), pretty));
+	RustPointer<char> str(RJsonValue_serialize(get(), pretty));
 	throwRustError(!str.get());
 	return str.get();
 }
 
+const JsonDocument::Node& JsonObject::member(const char *name) const
+{
+	auto const* n = m_doc->find(m_doc->nodes[m_node], name);
+	if (!n) {
+		throw std::runtime_error(ST::format("failed to get property {}", name).c_str());
+	}
+	return *n;
+}
+
 ST::string JsonObject::GetString(const char *name) const
 {
     return GetValue(name).toString();
@@ -157,6 +430,11 @@ double JsonObject::GetDouble(const char *name) const
 
 JsonValue JsonObject::GetValue(const char *name) const
 {
+    if (m_doc)
+    {
+        return JsonValue(m_doc, static_cast<uint32_t>(&member(name) - m_doc->nodes.data()));
+    }
+
     RustPointer<RJsonValue> prop(RJsonObject_get(m_value.get(), name));
     throwRustError(!prop);
     return JsonValue(prop.release());
@@ -229,15 +507,28 @@ const ST::string JsonObject::getOptionalString(const char *name) const
 
 bool JsonObject::has(const char *name) const
 {
+    if (m_doc)
+    {
+        return m_doc->find(m_doc->nodes[m_node], name) != nullptr;
+    }
     return RJsonObject_has(m_value.get(), name);
 }
 
 std::vector<ST::string> JsonObject::keys() const
 {
+	std::vector<ST::string> keys;
+	if (m_doc) {
+		auto const& n = m_doc->nodes[m_node];
+		keys.reserve(n.count);
+		for (uint32_t i = n.first; i < n.first + n.count; ++i) {
+			keys.push_back(NodeString(*m_doc, m_doc->nodes[i].keyOffset, m_doc->nodes[i].keyLength));
+		}
+		return keys;
+	}
+
 	RustPointer<VecCString> rKeys(RJsonObject_keys(m_value.get()));
 	throwRustError(!rKeys);
 	auto size = VecCString_len(rKeys.get());
-	std::vector<ST::string> keys;
 	for (uintptr_t i = 0; i < size; i++) {
 		RustPointer<char> key(VecCString_get(rKeys.get(), i));
 		throwRustError(!key);
@@ -248,11 +539,26 @@ std::vector<ST::string> JsonObject::keys() const
 
 void JsonObject::set(const char *name, JsonValue value)
 {
+	if (m_doc) {
+		// Becomes a standalone object that can be modified
+		*this = toRust();
+	}
 	RJsonObject_set(m_value.get(), name, value.get());
 }
 
+JsonObject JsonObject::toRust() const
+{
+	JsonObject obj;
+	auto const& n = m_doc->nodes[m_node];
+	for (uint32_t i = n.first; i < n.first + n.count; ++i) {
+		auto const& m = m_doc->nodes[i];
+		RJsonObject_set(obj.m_value.get(), NodeString(*m_doc, m.keyOffset, m.keyLength).c_str(), JsonValue(m_doc, i).get());
+	}
+	return obj;
+}
+
 JsonValue JsonObject::toValue() const
 {
+	if (m_doc) return JsonValue(m_doc, m_node);
 	return RJsonObject_toValue(m_value.get());
 }
-
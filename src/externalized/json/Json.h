@@ -3,10 +3,44 @@
 #include "RustInterface.h"
 
 #include <string_theory/string>
+#include <memory>
 #include <vector>
 
 class JsonObject;
 
+// Read-only copy of a whole JSON document, decoded from the Rust side in a
+// single call.  Values of the document refer to it by node index, so reading
+// a deserialized document does not cross into Rust again.
+struct JsonDocument
+{
+	enum Kind : uint8_t { Null, Bool, Int, UInt, Double, String, Array, Object };
+
+	struct Node
+	{
+		Kind     kind;
+		bool     b;
+		union
+		{
+			int64_t  i;
+			uint64_t u;
+			double   d;
+		};
+		uint32_t first;     // Array/Object: index of the first child node, String: offset into strings
+		uint32_t count;     // Array/Object: number of children, String: length in bytes
+		uint32_t keyOffset; // Object members: key offset into strings
+		uint32_t keyLength; // Object members: key length in bytes
+	};
+
+	// Children of a node are stored next to each other, members of an object
+	// are sorted by key
+	std::vector<Node> nodes;
+	std::string       strings;
+
+	static std::shared_ptr<const JsonDocument> decode(const RJsonValue*);
+
+	const Node* find(const Node& object, const char* name) const;
+};
+
 class JsonValue {
 	public:
 		// Takes ownership of RJsonValue
@@ -16,6 +50,8 @@ class JsonValue {
 		JsonValue(double value) : m_value(RustPointer<RJsonValue>(RJsonValue_fromDouble(value))) {}
 		JsonValue(bool value) : m_value(RustPointer<RJsonValue>(RJsonValue_fromBool(value))) {}
 		JsonValue(const ST::string& value) : m_value(RustPointer<RJsonValue>(RJsonValue_fromString(value.c_str()))) {}
+		// A value inside a decoded document
+		JsonValue(std::shared_ptr<const JsonDocument> doc, uint32_t node) : m_doc(std::move(doc)), m_node(node) {}
 
 		static JsonValue deserialize(const ST::string& str);
 		static JsonValue deserialize(const ST::string& vanillaStr, const ST::string& patchStr);
@@ -36,11 +72,16 @@ class JsonValue {
 		bool isObject() const;
 		JsonObject toObject() const;
 
-		const RJsonValue* get() const {
-			return m_value.get();
-		}
+		// Values inside a decoded document are converted back on demand
+		const RJsonValue* get() const;
 	private:
-		RustPointer<RJsonValue> m_value;
+		const JsonDocument::Node* node() const {
+			return m_doc ? &m_doc->nodes[m_node] : nullptr;
+		}
+
+		mutable RustPointer<RJsonValue> m_value;
+		std::shared_ptr<const JsonDocument> m_doc;
+		uint32_t m_node = 0;
 };
 
 class JsonArray
@@ -72,6 +113,8 @@ class JsonObject
 		{
 			m_value.reset(value);
 		}
+		// An object inside a decoded document, read-only
+		JsonObject(std::shared_ptr<const JsonDocument> doc, uint32_t node) : m_doc(std::move(doc)), m_node(node) {}
 
 		ST::string GetString(const char *name) const;
 		int GetInt(const char *name) const;
@@ -90,5 +133,13 @@ class JsonObject
 		void set(const char* name, JsonValue value);
 		JsonValue toValue() const;
 	protected:
+		// Throws if the member does not exist
+		const JsonDocument::Node& member(const char* name) const;
+		// Copy of an object inside a decoded document that can be modified
+		JsonObject toRust() const;
+		friend class JsonValue;
+
 		RustPointer<RJsonObject> m_value;
+		std::shared_ptr<const JsonDocument> m_doc;
+		uint32_t m_node = 0;
 };
@@ -40,6 +40,8 @@
 #include "Video.h"
 #include "WorldDef.h"
 #include "UILayout.h"
+#include "ContentManager.h"
+#include "GameInstance.h"
 
 #include <string_theory/format>
 #include <string_theory/string>
@@ -869,6 +871,9 @@ static ScreenID ProcessFileIO(void)
 			if( gfShowPits )
 				AddAllPits();
 
+			// the map may be new to the resource index, make it loadable right away
+			GCM->rescanGameResources();
+
 			SetGlobalSectorValues(ioFilename);
 
 			if( gfGlobalSummaryExists )
@@ -41,6 +41,12 @@
 #include <string_theory/format>
 #include <string_theory/string>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
 #include <vector>
 
 #define DEVINFO_DIR "DevInfo"
@@ -2173,9 +2179,97 @@ static void ReportError(const ST::string& pSector, UINT8 ubLevel)
 }
 
 
+// A map whose summary is evaluated by the worker threads
+struct SummaryJob
+{
+	ST::string   sector;
+	UINT8        level;
+	ST::string   filename;
+	HWFILE       file;
+	SUMMARYFILE* summary;
+};
+
+
+/* Evaluates the maps of the jobs on a pool of worker threads.  The files are
+ * opened beforehand by the calling thread, which then waits for the workers and
+ * calls progress with the number of maps done whenever that number changes.
+ * Jobs that fail are left without summary. */
+static void EvaluateWorldsInParallel(std::vector<SummaryJob>& jobs, void (*const progress)(size_t done, size_t total))
+{
+	for (SummaryJob& job : jobs)
+	{
+		try
+		{
+			job.file = GCM->openMapForReading(job.filename);
+		}
+		catch (const std::runtime_error& e)
+		{
+			SLOGW("Cannot open map {}: {}", job.filename, e.what());
+		}
+	}
+
+	std::atomic<size_t>     next{0};
+	size_t                  done = 0;
+	std::mutex              mutex;
+	std::condition_variable cond;
+
+	auto const worker = [&]()
+	{
+		for (size_t i; (i = next++) < jobs.size();)
+		{
+			SummaryJob& job = jobs[i];
+			if (job.file)
+			{
+				try
+				{
+					job.summary = EvaluateWorldFile(job.file, NULL);
+				}
+				catch (const std::exception& e)
+				{
+					SLOGW("Cannot evaluate map {}: {}", job.filename, e.what());
+				}
+			}
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				++done;
+			}
+			cond.notify_one();
+		}
+	};
+
+	size_t const n_threads = std::max(1U, std::min(std::thread::hardware_concurrency(), 8U));
+	std::vector<std::thread> threads;
+	for (size_t i = 0; i != n_threads; ++i) threads.emplace_back(worker);
+
+	for (size_t reported = 0; reported != jobs.size();)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			cond.wait(lock, [&]{ return done != reported; });
+			reported = done;
+		}
+		progress(reported, jobs.size());
+	}
+
+	for (std::thread& t : threads) t.join();
+
+	for (SummaryJob& job : jobs)
+	{
+		delete job.file;
+		job.file = NULL;
+	}
+}
+
+
+static void RenderRegenerationProgress(size_t const done, size_t const total)
+{
+	SetRelativeStartAndEndPercentage(0, 0, 100, ST::format("Analyzed {} of {} maps", done, total));
+	RenderProgressBar(0, static_cast<UINT32>(done * 100 / total));
+}
+
+
 static void RegenerateSummaryInfoForAllOutdatedMaps(void)
 {
-	SUMMARYFILE *pSF;
 	//CreateProgressBar(0, 20, 120, 280, 12); //slave (individual)
 	//CreateProgressBar(1, 20, 100, 280, 12); //master (total)
 	//DefineProgressBarPanel( 0, 65, 79, 94, 10, 80, 310, 152 );
@@ -2189,66 +2283,39 @@ static void RegenerateSummaryInfoForAllOutdatedMaps(void)
 	gusTotal = gusNumEntriesWithOutdatedOrNoSummaryInfo;
 	UpdateMasterProgress();
 
+	// Collect the maps of all levels that have no or an outdated summary
+	static const UINT8 level_masks[] =
+	{
+		GROUND_LEVEL_MASK, BASEMENT1_LEVEL_MASK, BASEMENT2_LEVEL_MASK, BASEMENT3_LEVEL_MASK,
+		ALTERNATE_GROUND_MASK, ALTERNATE_B1_MASK, ALTERNATE_B2_MASK, ALTERNATE_B3_MASK
+	};
+	std::vector<SummaryJob> jobs;
 	SGPSector sMap;
 	for (sMap.y = 1; sMap.y <= 16; sMap.y++) for(sMap.x = 1; sMap.x <= 16; sMap.x++)
 	{
 		INT32 x = sMap.x - 1, y = sMap.y - 1;
 		const ST::string str = sMap.AsShortString();
-		if( gbSectorLevels[x][y] & GROUND_LEVEL_MASK )
+		for (UINT8 level = 0; level != lengthof(level_masks); ++level)
 		{
-			pSF = gpSectorSummary[x][y][0];
-			if( !pSF || pSF->ubSummaryVersion != GLOBAL_SUMMARY_VERSION )
-				if( !EvaluateWorld( str, 0 ) )
-					ReportError( str, 0 );
+			if (!(gbSectorLevels[x][y] & level_masks[level])) continue;
+			SUMMARYFILE const* const pSF = gpSectorSummary[x][y][level];
+			if (pSF && pSF->ubSummaryVersion == GLOBAL_SUMMARY_VERSION) continue;
+			jobs.push_back(SummaryJob{ str, level, GetSummaryMapFilename(str, level), NULL, NULL });
 		}
-		if( gbSectorLevels[x][y] & BASEMENT1_LEVEL_MASK )
-		{
-			pSF = gpSectorSummary[x][y][1];
-			if( !pSF || pSF->ubSummaryVersion != GLOBAL_SUMMARY_VERSION )
-				if( !EvaluateWorld( str, 1 ) )
-					ReportError( str, 1 );
-		}
-		if( gbSectorLevels[x][y] & BASEMENT2_LEVEL_MASK )
-		{
-			pSF = gpSectorSummary[x][y][2];
-			if( !pSF || pSF->ubSummaryVersion != GLOBAL_SUMMARY_VERSION )
-				if( !EvaluateWorld( str, 2 ) )
-					ReportError( str, 2 );
-		}
-		if( gbSectorLevels[x][y] & BASEMENT3_LEVEL_MASK )
-		{
-			pSF = gpSectorSummary[x][y][3];
-			if( !pSF || pSF->ubSummaryVersion != GLOBAL_SUMMARY_VERSION )
-				if( !EvaluateWorld( str, 3 ) )
-					ReportError( str, 3 );
-		}
-		if( gbSectorLevels[x][y] & ALTERNATE_GROUND_MASK )
-		{
-			pSF = gpSectorSummary[x][y][4];
-			if( !pSF || pSF->ubSummaryVersion != GLOBAL_SUMMARY_VERSION )
-				if( !EvaluateWorld( str, 4 ) )
-					ReportError( str, 4 );
-		}
-		if( gbSectorLevels[x][y] & ALTERNATE_B1_MASK )
-		{
-			pSF = gpSectorSummary[x][y][5];
-			if( !pSF || pSF->ubSummaryVersion != GLOBAL_SUMMARY_VERSION )
-				if( !EvaluateWorld( str, 5 ) )
-					ReportError( str, 5 );
-		}
-		if( gbSectorLevels[x][y] & ALTERNATE_B2_MASK )
+	}
+
+	if (!jobs.empty()) EvaluateWorldsInParallel(jobs, RenderRegenerationProgress);
+
+	// Writing the summaries updates the global tables, so this is done here
+	for (SummaryJob const& job : jobs)
+	{
+		if (job.summary)
 		{
-			pSF = gpSectorSummary[x][y][6];
-			if( !pSF || pSF->ubSummaryVersion != GLOBAL_SUMMARY_VERSION )
-				if( !EvaluateWorld( str, 6 ) )
-					ReportError( str, 6 );
+			WriteSectorSummaryUpdate(job.filename, job.level, job.summary);
 		}
-		if( gbSectorLevels[x][y] & ALTERNATE_B3_MASK )
+		else
 		{
-			pSF = gpSectorSummary[x][y][7];
-			if( !pSF || pSF->ubSummaryVersion != GLOBAL_SUMMARY_VERSION )
-				if( !EvaluateWorld( str, 7 ) )
-					ReportError( str, 7 );
+			ReportError(job.sector, job.level);
 		}
 	}
 	RemoveProgressBar( 0 );
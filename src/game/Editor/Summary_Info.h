@@ -98,6 +98,16 @@ struct SUMMARYFILE
 extern BOOLEAN gfAutoLoadA9;
 
 extern BOOLEAN EvaluateWorld(const ST::string& pSector, UINT8 ubLevel);
+
+// Name of the map file of the given level of a sector, e.g. "A9_b1.dat"
+ST::string GetSummaryMapFilename(const ST::string& pSector, UINT8 ubLevel);
+
+/* Extracts the summary information out of an open map file.  Only the header,
+ * the placements and the other tables the summary needs are parsed, the world
+ * itself is skipped.  No global state is touched, so several maps can be
+ * evaluated at the same time.  progress (may be NULL) is called with the
+ * percentage done.  Throws on a broken file. */
+SUMMARYFILE* EvaluateWorldFile(HWFILE, void (*progress)(UINT32 percentage));
 void WriteSectorSummaryUpdate(const ST::string &filename, UINT8 ubLevel, SUMMARYFILE*);
 
 extern BOOLEAN gfMustForceUpdateAllMaps;
@@ -1,6 +1,8 @@
 #include "GameLoop.h"
+#include "Animation_Data.h"
 #include "GameVersion.h"
 #include "Input.h"
+#include "InputRecorder.h"
 #include "SGP.h"
 #include "Screens.h"
 #include "ShopKeeper_Interface.h"
@@ -114,19 +116,22 @@ try
 	InputAtom InputEvent;
 	ScreenID uiOldScreen = guiCurrentScreen;
 
-	auto const MousePos{ GetMousePos() };
-	// Hook into mouse stuff for MOVEMENT MESSAGES
-	MouseSystemHook(MOUSE_POS, 0, MousePos.iX, MousePos.iY);
-	MusicPoll();
-
-	HandleSingleClicksAndButtonRepeats();
-	while (DequeueSpecificEvent(&InputEvent, MOUSE_EVENTS))
-	{
-		MouseSystemHook(InputEvent.usEvent, InputEvent.usParam, MousePos.iX, MousePos.iY);
-	}
-	while (DequeueSpecificEvent(&InputEvent, TOUCH_EVENTS))
 	{
-		MouseSystemHook(InputEvent.usEvent, InputEvent.usParam, MousePos.iX, MousePos.iY);
+		InputRecorder::SubsystemTimer const timer("input");
+		auto const MousePos{ GetMousePos() };
+		// Hook into mouse stuff for MOVEMENT MESSAGES
+		MouseSystemHook(MOUSE_POS, 0, MousePos.iX, MousePos.iY);
+		MusicPoll();
+
+		HandleSingleClicksAndButtonRepeats();
+		while (DequeueSpecificEvent(&InputEvent, MOUSE_EVENTS))
+		{
+			MouseSystemHook(InputEvent.usEvent, InputEvent.usParam, MousePos.iX, MousePos.iY);
+		}
+		while (DequeueSpecificEvent(&InputEvent, TOUCH_EVENTS))
+		{
+			MouseSystemHook(InputEvent.usEvent, InputEvent.usParam, MousePos.iX, MousePos.iY);
+		}
 	}
 
 
@@ -203,7 +208,14 @@ try
 
 
 
-	uiOldScreen = (*(GameScreens[guiCurrentScreen].HandleScreen))();
+	// Take over animation surfaces the background loader has finished.  Every
+	// screen can load soldier animations, not just the tactical one.
+	UpdateAnimationSurfacePrefetch();
+
+	{
+		InputRecorder::SubsystemTimer const timer("screen");
+		uiOldScreen = (*(GameScreens[guiCurrentScreen].HandleScreen))();
+	}
 
 	// if the screen has chnaged
 	if( uiOldScreen != guiCurrentScreen )
@@ -212,7 +224,10 @@ try
 		guiCurrentScreen = uiOldScreen;
 	}
 
-	RefreshScreen();
+	{
+		InputRecorder::SubsystemTimer const timer("render");
+		RefreshScreen();
+	}
 
 	guiGameCycleCounter++;
 
@@ -26,6 +26,9 @@
 #include <string_theory/format>
 #include <string_theory/string>
 
+#include <algorithm>
+#include <vector>
+
 
 #define MAX_MESSAGES_PAGE 18 // max number of messages per page
 
@@ -43,13 +46,6 @@ enum EMailSortCriteria
 };
 
 
-struct Page
-{
-	Email* Mail[MAX_MESSAGES_PAGE];
-	Page* Next;
-};
-
-
 struct Record
 {
 	ST::string pRecord;
@@ -65,8 +61,15 @@ struct EmailPageInfoStruct
 };
 
 
-Email* pEmailList;
-static Page* pPageList;
+// the mails in the order they are listed, the pages are slices of it
+static std::vector<Email*> gEmailList;
+
+// the mails sorted ascending by each column, mails with equal keys are kept
+// in the order they arrived in
+static std::vector<Email*> gEmailsBySender;
+static std::vector<Email*> gEmailsBySubject;
+static std::vector<Email*> gEmailsByDate;
+
 static INT32 iLastPage=-1;
 static INT32 iCurrentPage=0;
 Email* MailToDelete;
@@ -272,8 +275,10 @@ static void DeleteEmailMouseRegions()
 
 void GameInitEmail()
 {
-	pEmailList=NULL;
-	pPageList=NULL;
+	gEmailList.clear();
+	gEmailsBySender.clear();
+	gEmailsBySubject.clear();
+	gEmailsByDate.clear();
 
 	CurrentMail = NULL;
 	PreviousMail = NULL;
@@ -518,7 +523,8 @@ static ST::string LoadEMailText(UINT32 entry)
 }
 
 
-static void AddMessageToPages(Email* Mail);
+static void AddToSortIndexes(Email*);
+static void PlaceMessagesinPages(void);
 static ST::string ReplaceMercNameAndAmountWithProperData(const ST::string& pFinishedString, const Email* pMail);
 
 
@@ -545,186 +551,109 @@ void AddEmailMessage(INT32 iMessageOffset, INT32 iMessageLength, INT32 iDate, UI
 	pSubject = ReplaceMercNameAndAmountWithProperData(pSubject, pTempEmail);
 	pTempEmail->pSubject = ST::format(" {}", pSubject);
 
-	// place into list
-	Email* pEmail = pEmailList;
-	if(pEmail)
-	{
-		// list exists, place at end
-		while (pEmail->Next != NULL) pEmail = pEmail->Next;
-		pEmail->Next = pTempEmail;
-	}
-	else
-	{
-		// no list, becomes head of a new list
-		pEmailList = pTempEmail;
-	}
-	pTempEmail->Prev = pEmail;
+	// reset read flag of this particular message
+	pTempEmail->fRead=fAlreadyRead;
 
-	// reset Next ptr
-	pTempEmail->Next=NULL;
+	// place at the end of the list
+	gEmailList.push_back(pTempEmail);
+	AddToSortIndexes(pTempEmail);
 
 	// set flag that new mail has arrived
 	fNewMailFlag=TRUE;
 
 	// add this message to the pages of email
-	AddMessageToPages(pTempEmail);
-
-	// reset read flag of this particular message
-	pTempEmail->fRead=fAlreadyRead;
+	PlaceMessagesinPages();
 }
 
 
-static void RemoveEmailMessage(Email* Mail)
+static bool SenderLess(Email const* const a, Email const* const b)
 {
-	Email* Next = Mail->Next;
-	Email* Prev = Mail->Prev;
-	if (Next != NULL) Next->Prev = Prev;
-	if (Prev != NULL)
-	{
-		Prev->Next = Next;
-	}
-	else
-	{
-		Assert(pEmailList == Mail);
-		pEmailList = Next;
-	}
-	delete Mail;
+	return pSenderNameList[a->ubSender].compare(pSenderNameList[b->ubSender]) < 0;
 }
 
 
-static void AddEmailPage(void)
+static bool SubjectLess(Email const* const a, Email const* const b)
 {
-	Page* const p = new Page{};
-	FOR_EACH(Email*, i, p->Mail) *i = 0;
-	p->Next = NULL;
+	return a->pSubject.compare(b->pSubject) < 0;
+}
 
-	if (pPageList)
-	{
-		Page* last = pPageList;
-		while (last->Next) last = last->Next;
-		last->Next = p;
-	}
-	else
-	{
-		pPageList = p;
-	}
 
-	iLastPage++;
+static bool DateLess(Email const* const a, Email const* const b)
+{
+	return a->iDate < b->iDate;
 }
 
 
-static void AddMessageToPages(Email* Mail)
+static void InsertIntoSortIndex(std::vector<Email*>& index, Email* const Mail, bool (* const less)(Email const*, Email const*))
 {
-	// go to end of page list
-	Page* pPage = pPageList;
-	INT32 iCounter=0;
-	if(!pPage)
-		AddEmailPage();
-	pPage=pPageList;
-	while (pPage->Next != NULL && pPage->Mail[MAX_MESSAGES_PAGE - 1] != NULL)
-		pPage=pPage->Next;
-	// if list is full, add new page
-	while(iCounter <MAX_MESSAGES_PAGE)
-	{
-		if (pPage->Mail[iCounter] == NULL) break;
-		iCounter++;
-	}
-	if(iCounter==MAX_MESSAGES_PAGE)
-	{
-		AddEmailPage();
-		AddMessageToPages(Mail);
-	}
-	else
-	{
-		pPage->Mail[iCounter] = Mail;
-	}
+	// behind all mails with an equal key, they arrived earlier
+	index.insert(std::upper_bound(index.begin(), index.end(), Mail, less), Mail);
 }
 
 
-static void SortMessages(EMailSortCriteria Criterium)
+static void AddToSortIndexes(Email* const Mail)
 {
-	Email* NewList = NULL;
+	InsertIntoSortIndex(gEmailsBySender,  Mail, SenderLess);
+	InsertIntoSortIndex(gEmailsBySubject, Mail, SubjectLess);
+	InsertIntoSortIndex(gEmailsByDate,    Mail, DateLess);
+}
 
-	for (Email* List = pEmailList; List != NULL;)
-	{
-		Email* Mail = List;
-		List = List->Next;
 
-		Email* InsAfter = NULL;
-		for (Email* Other = NewList; Other != NULL; Other = Other->Next)
-		{
-			INT Order; // XXX HACK000E
-			switch (Criterium)
-			{
-				case RECEIVED:
-					Order = Mail->iDate - Other->iDate;
-					if (fSortDateUpwards) Order = -Order;
-					break;
-
-				case SENDER:
-					Order = pSenderNameList[Mail->ubSender].compare(pSenderNameList[Other->ubSender]);
-					if (fSortSenderUpwards) Order = -Order;
-					break;
-
-				case SUBJECT:
-					Order = Mail->pSubject.compare(Other->pSubject);
-					if (fSortSubjectUpwards) Order = -Order;
-					break;
-
-				case READ:
-					Order = Other->fRead - Mail->fRead;
-					break;
-
-				default: abort(); // HACK000E
-			}
-			if (Order > 0) break;
-			InsAfter = Other;
-		}
-		Mail->Prev = InsAfter;
-		if (InsAfter == NULL)
-		{
-			Mail->Next = NewList;
-			NewList = Mail;
-		}
-		else
-		{
-			Mail->Next = InsAfter->Next;
-			InsAfter->Next = Mail;
-		}
-		if (Mail->Next != NULL) Mail->Next->Prev = Mail;
-	}
-	pEmailList = NewList;
+static void EraseMail(std::vector<Email*>& list, Email* const Mail)
+{
+	list.erase(std::find(list.begin(), list.end(), Mail));
+}
 
-	fReDrawScreenFlag = TRUE;
+
+static void RemoveEmailMessage(Email* Mail)
+{
+	EraseMail(gEmailList,       Mail);
+	EraseMail(gEmailsBySender,  Mail);
+	EraseMail(gEmailsBySubject, Mail);
+	EraseMail(gEmailsByDate,    Mail);
+	delete Mail;
 }
 
 
-static void ClearPages(void)
+// list the mails in the order of a sort index
+static void ListInSortOrder(std::vector<Email*> const& index, BOOLEAN const fUpwards, bool (* const less)(Email const*, Email const*))
 {
-	// run through list of message pages and set to -1
-	for (Page* i = pPageList; i;)
+	gEmailList = index;
+	if (fUpwards) return;
+
+	// downwards, but mails with equal keys stay in the order they arrived in
+	std::reverse(gEmailList.begin(), gEmailList.end());
+	for (auto i = gEmailList.begin(); i != gEmailList.end();)
 	{
-		Page* const next = i->Next;
-		delete i;
-		i = next;
+		auto j = i + 1;
+		while (j != gEmailList.end() && !less(*j, *i)) ++j;
+		std::reverse(i, j);
+		i = j;
 	}
-
-	pPageList = NULL;
-	iLastPage = -1;
 }
 
 
-static void PlaceMessagesinPages(void)
+static void SortMessages(EMailSortCriteria Criterium)
 {
-	Email* pEmail = pEmailList;
-	// run through the list of messages and add to pages
-	ClearPages();
-	while(pEmail)
+	switch (Criterium)
 	{
-		AddMessageToPages(pEmail);
-		pEmail=pEmail->Next;
+		case RECEIVED: ListInSortOrder(gEmailsByDate,    fSortDateUpwards,    DateLess);    break;
+		case SENDER:   ListInSortOrder(gEmailsBySender,  fSortSenderUpwards,  SenderLess);  break;
+		case SUBJECT:  ListInSortOrder(gEmailsBySubject, fSortSubjectUpwards, SubjectLess); break;
 
+		case READ:
+			// unread mails first, otherwise keep the current order
+			std::stable_partition(gEmailList.begin(), gEmailList.end(), [](Email const* const e) { return !e->fRead; });
+			break;
 	}
+
+	fReDrawScreenFlag = TRUE;
+}
+
+
+static void PlaceMessagesinPages(void)
+{
+	iLastPage = (static_cast<INT32>(gEmailList.size()) + MAX_MESSAGES_PAGE - 1) / MAX_MESSAGES_PAGE - 1;
 	if(iCurrentPage >iLastPage)
 		iCurrentPage=iLastPage;
 }
@@ -751,14 +680,11 @@ static void DrawEmailSummary(INT32 y, const Email* e)
 }
 
 
-static Page* GetCurrentPage(void)
+// the mail in line i of the current page, NULL if the line is empty
+static Email* GetEmailOnCurrentPage(INT32 const i)
 {
-	Page* i = pPageList;
-	if (i == NULL) return i;
-
-	INT32 PageID = 0;
-	while (i->Next != NULL && PageID++ != iCurrentPage) i = i->Next;
-	return i;
+	size_t const idx = std::max(iCurrentPage, 0) * MAX_MESSAGES_PAGE + i;
+	return idx < gEmailList.size() ? gEmailList[idx] : NULL;
 }
 
 
@@ -769,20 +695,18 @@ static void DisplayEmailList(void)
 	// if current page ever ends up negative, reset to 0
 	if (iCurrentPage == -1) iCurrentPage = 0;
 
-	const Page* const p = GetCurrentPage();
-	if (p == NULL) return;
-
-	// now we have current page, display it
+	// display the current page
 	SetFontForeground(FONT_BLACK);
 	SetFontBackground(FONT_BLACK);
 	SetFontShadow(NO_SHADOW);
 
 	// draw each line of the list for this page
 	INT32 y = MIDDLE_Y;
-	FOR_EACH(Email* const, e, p->Mail)
+	for (INT32 i = 0; i < MAX_MESSAGES_PAGE; ++i)
 	{
-		if (!*e) break;
-		DrawEmailSummary(y, *e);
+		const Email* const e = GetEmailOnCurrentPage(i);
+		if (!e) break;
+		DrawEmailSummary(y, e);
 		y += MIDDLE_WIDTH;
 	}
 
@@ -798,19 +722,8 @@ void LookForUnread()
 
 	// simply runrs through list of messages, if any unread, set unread flag
 
-	Email* pA = pEmailList;
-
-	// reset unread flag
-	fUnReadMailFlag=FALSE;
-
 	// look for unread mail
-	while(pA)
-	{
-		// unread mail found, set flag
-		if(!(pA->fRead))
-			fUnReadMailFlag=TRUE;
-		pA=pA->Next;
-	}
+	fUnReadMailFlag = std::any_of(gEmailList.begin(), gEmailList.end(), [](Email const* const e) { return !e->fRead; });
 
 	if( fStatusOfNewEmailFlag != fUnReadMailFlag )
 	{
@@ -843,13 +756,10 @@ static void EmailBtnCallBackPrimary(MOUSE_REGION* pRegion, UINT32 iReason)
 	if(fDisplayMessageFlag)
 		return;
 
-	Page* pPage = GetCurrentPage();
-	if (pPage == NULL) return;
-
 	// error check
 	INT32 iCount = MSYS_GetRegionUserData(pRegion, 0);
 
-	Email* Mail = pPage->Mail[iCount];
+	Email* Mail = GetEmailOnCurrentPage(iCount);
 
 	// invalid message
 	if (Mail == NULL)
@@ -869,18 +779,11 @@ static void EmailBtnCallBackSecondary(MOUSE_REGION* pRegion, UINT32 iReason)
 	if(fDisplayMessageFlag)
 		return;
 
-	Page* pPage = GetCurrentPage();
-	if (pPage == NULL)
-	{
-		HandleRightButtonUpEvent();
-		return;
-	}
-
 	INT32 iCount = MSYS_GetRegionUserData(pRegion, 0);
 
 	giMessagePage = 0;
 
-	Email* Mail = pPage->Mail[iCount];
+	Email* Mail = GetEmailOnCurrentPage(iCount);
 	if (Mail == NULL)
 	{
 		// no mail here, handle right button up event
@@ -1416,13 +1319,9 @@ static void DeleteEmail(void)
 	// stop displaying message, if so
 	fDisplayMessageFlag = FALSE;
 
-	// upadte list
+	// upadte list, if all of a sudden we are beyond last page, move back one
 	PlaceMessagesinPages();
 
-	// if all of a sudden we are beyond last page, move back one
-	if(iCurrentPage > iLastPage)
-		iCurrentPage=iLastPage;
-
 	// rerender mail list
 	RenderEmail();
 
@@ -1439,7 +1338,6 @@ static void FromCallback(GUI_BUTTON *btn, UINT32 iReason)
 		// sort messages based on sender name, then replace into pages of email
 		fSortSenderUpwards = !fSortSenderUpwards;
 		SortMessages(SENDER);
-		PlaceMessagesinPages();
 	}
 }
 
@@ -1451,7 +1349,6 @@ static void SubjectCallback(GUI_BUTTON *btn, UINT32 iReason)
 		// sort message on subject and reorder list
 		fSortSubjectUpwards = !fSortSubjectUpwards;
 		SortMessages(SUBJECT);
-		PlaceMessagesinPages();
 	}
 }
 
@@ -1472,7 +1369,6 @@ static void DateCallback(GUI_BUTTON *btn, UINT32 iReason)
 		// sort messages based on date recieved and reorder lsit
 		fSortDateUpwards = !fSortDateUpwards;
 		SortMessages(RECEIVED);
-		PlaceMessagesinPages();
 	}
 }
 
@@ -1483,7 +1379,6 @@ static void ReadCallback(GUI_BUTTON *btn, UINT32 iReason)
 	{
 		// sort messages based on date recieved and reorder lsit
 		SortMessages(READ);
-		PlaceMessagesinPages();
 	}
 }
 
@@ -2239,10 +2134,9 @@ static void OpenMostRecentUnreadEmail(void)
 {
 	// will open the most recent email the player has recieved and not read
 	Email* MostRecentMail = NULL;
-	Email* pB = pEmailList;
 	UINT32 iLowestDate = 9999999;
 
-	while( pB )
+	for (Email* const pB : gEmailList)
 	{
 		// if date is lesser and unread , swap
 		if (pB->iDate < iLowestDate && !pB->fRead)
@@ -2250,9 +2144,6 @@ static void OpenMostRecentUnreadEmail(void)
 			MostRecentMail = pB;
 			iLowestDate = pB -> iDate;
 		}
-
-		// next in B's list
-		pB=pB->Next;
 	}
 
 	CurrentMail = MostRecentMail;
@@ -2301,15 +2192,18 @@ static INT32 GetNumberOfPagesToEmail(void)
 void ShutDownEmailList()
 {
 	// Loop through all the emails to delete them
-	Email* i = pEmailList;
-	pEmailList = 0;
-	while (i)
-	{
-		Email* const del = i;
-		i = i->Next;
-		delete del;
-	}
-	ClearPages();
+	for (Email* const i : gEmailList) delete i;
+	gEmailList.clear();
+	gEmailsBySender.clear();
+	gEmailsBySubject.clear();
+	gEmailsByDate.clear();
+	iLastPage = -1;
+}
+
+
+std::vector<Email*> const& GetEmailList()
+{
+	return gEmailList;
 }
 
 
@@ -4,6 +4,7 @@
 #include "Types.h"
 
 #include <string_theory/string>
+#include <vector>
 
 
 #define IMP_EMAIL_INTRO				0
@@ -143,9 +144,6 @@ struct Email
 	INT32   iFirstData;
 	UINT32  uiSecondData;
 	BOOLEAN fRead;
-
-	Email* Next;
-	Email* Prev;
 };
 
 
@@ -171,7 +169,6 @@ extern BOOLEAN  fOldNewMailFlag;
 extern BOOLEAN fDisplayMessageFlag;
 extern BOOLEAN fReDrawNewMailFlag;
 extern BOOLEAN fOpenMostRecentUnReadFlag;
-extern Email* pEmailList;
 extern Email* MailToDelete;
 extern SGPVObject* guiEmailWarning;
 
@@ -193,6 +190,9 @@ void CreateDestroyNewMailButton(void);
 void CreateDestroyDeleteNoticeMailButton(void);
 void ReDrawNewMailBox( void );
 void ShutDownEmailList(void);
+
+// All mails in the order they are listed in
+std::vector<Email*> const& GetEmailList(void);
 void AddEmailWithSpecialData(INT32 iMessageOffset, INT32 iMessageLength, UINT8 ubSender, INT32 iDate, INT32 iFirstData, UINT32 uiSecondData );
 
 #endif
@@ -23,6 +23,9 @@
 #include <string_theory/format>
 #include <string_theory/string>
 
+#include <algorithm>
+#include <vector>
+
 
 #define FINANCE_HEADER_SIZE 4
 #define FINANCE_RECORD_SIZE (1 + 1 + 4 + 4 + 4)
@@ -36,7 +39,8 @@ struct FinanceUnit
 	UINT32 uiDate; // time in the world in global time
 	INT32 iAmount; // the amount of the transaction
 	INT32 iBalanceToDate;
-	FinanceUnit* Next; // next unit in the list
+	INT32 iMineIncomeToDate; // running total of the mine deposits
+	INT32 iOtherDepositsToDate; // running total of all other deposits
 };
 
 
@@ -107,14 +111,11 @@ enum{
 
 
 
-// sizeof one record
-#define RECORD_SIZE ( sizeof( UINT32 ) + sizeof( INT32 ) + sizeof( INT32 ) + sizeof( UINT8 ) + sizeof( UINT8 ) )
-
-
-
-
-// the financial record list
-static FinanceUnit* pFinanceListHead = NULL;
+// All records of FINANCES_DATA_FILE in the order they were made.  The file
+// is only read once after it has been replaced, every new record is appended
+// to both.
+static std::vector<FinanceUnit> gFinanceLedger;
+static bool gfFinanceLedgerLoaded = false;
 
 // current page displayed
 static INT32 iCurrentPage = 0;
@@ -139,16 +140,16 @@ static BUTTON_PICS* giFinanceButtonImage[4];
 static MOUSE_REGION g_scroll_region;
 
 // internal functions
-static void ProcessAndEnterAFinancialRecord(UINT8 ubCode, UINT32 uiDate, INT32 iAmount, UINT8 ubSecondCode, INT32 iBalanceToDate);
+static std::vector<FinanceUnit> const& GetFinanceLedger(void);
+static void EnterFinanceRecord(UINT8 ubCode, UINT8 ubSecondCode, UINT32 uiDate, INT32 iAmount, INT32 iBalanceToDate);
 static void LoadFinances(void);
 static void RemoveFinances(void);
-static void ClearFinanceList(void);
 static void DrawRecordsColumnHeadersText(void);
 static void CreateFinanceButtons(void);
 static void DestroyFinanceButtons(void);
 static void GetBalanceFromDisk(void);
 static void WriteBalanceToDisk(void);
-static void AppendFinanceToEndOfFile(void);
+static void AppendFinanceToEndOfFile(FinanceUnit const&);
 static void SetLastPageInRecords(void);
 static void LoadInRecords(UINT32 page);
 
@@ -182,28 +183,24 @@ void AddTransactionToPlayersBook(UINT8 ubCode, UINT8 ubSecondCode, UINT32 uiDate
 		gMercProfiles[ ubSecondCode ].uiTotalCostToDate += -iAmount;
 	}
 
-	// clear list
-	ClearFinanceList( );
+	// the ledger has to be read before the file gets the new record
+	GetFinanceLedger();
 
 	// update balance
 	LaptopSaveInfo.iCurrentBalance += iAmount;
 
-	ProcessAndEnterAFinancialRecord(ubCode, uiDate, iAmount, ubSecondCode, LaptopSaveInfo.iCurrentBalance);
+	EnterFinanceRecord(ubCode, ubSecondCode, uiDate, iAmount, LaptopSaveInfo.iCurrentBalance);
 
 	// write balance to disk
 	WriteBalanceToDisk( );
 
 	// append to end of file
-	AppendFinanceToEndOfFile();
+	AppendFinanceToEndOfFile(gFinanceLedger.back());
 
 	// set number of pages
 	SetLastPageInRecords( );
 
-	if( !fInFinancialMode )
-	{
-		ClearFinanceList( );
-	}
-	else
+	if( fInFinancialMode )
 	{
 		SetFinanceButtonStates( );
 
@@ -248,9 +245,17 @@ void GameInitFinances()
 {
 	// initialize finances on game start up
 	GCM->tempFiles()->deleteFile(FINANCES_DATA_FILE);
+	ResetFinancesLedger();
 	GetBalanceFromDisk( );
 }
 
+
+void ResetFinancesLedger(void)
+{
+	gFinanceLedger.clear();
+	gfFinanceLedgerLoaded = false;
+}
+
 void EnterFinances()
 {
 	//entry into finanacial system, load graphics, set variables..draw screen once
@@ -287,9 +292,6 @@ void ExitFinances( void )
 	// destroy buttons
 	DestroyFinanceButtons( );
 
-	// clear out list
-	ClearFinanceList( );
-
 
 	// remove graphics
 	RemoveFinances( );
@@ -479,10 +481,15 @@ static void DrawRecordsText(void)
 	SetFontBackground(FONT_BLACK);
 	SetFontShadow(NO_SHADOW);
 
-	const FinanceUnit* fu = pFinanceListHead;
-	for (INT32 i = 0; i < NUM_RECORDS_PER_PAGE && fu != NULL; ++i, fu = fu->Next)
+	if (iCurrentPage == 0) return;
+
+	std::vector<FinanceUnit> const& ledger = GetFinanceLedger();
+	size_t const first = NUM_RECORDS_PER_PAGE * (iCurrentPage - 1);
+	size_t const last  = std::min(first + NUM_RECORDS_PER_PAGE, ledger.size());
+	for (size_t i = first; i < last; ++i)
 	{
-		const INT32 y = 12 + RECORD_Y + i * (GetFontHeight(FINANCE_TEXT_FONT) + 6);
+		const FinanceUnit* const fu = &ledger[i];
+		const INT32 y = 12 + RECORD_Y + static_cast<INT32>(i - first) * (GetFontHeight(FINANCE_TEXT_FONT) + 6);
 
 		SetFontForeground(FONT_BLACK);
 
@@ -674,42 +681,71 @@ static void DrawSummaryText(void)
 }
 
 
-static void ClearFinanceList(void)
+static void EnterFinanceRecord(const UINT8 ubCode, const UINT8 ubSecondCode, const UINT32 uiDate, const INT32 iAmount, const INT32 iBalanceToDate)
 {
-	// remove each element from list of transactions
-	FinanceUnit* pFinanceList = pFinanceListHead;
-	FinanceUnit* pFinanceNode = pFinanceList;
-
-	// while there are elements in the list left, delete them
-	while( pFinanceList )
+	FinanceUnit fu{};
+	fu.ubCode         = ubCode;
+	fu.ubSecondCode   = ubSecondCode;
+	fu.uiDate         = uiDate;
+	fu.iAmount        = iAmount;
+	fu.iBalanceToDate = iBalanceToDate;
+
+	if (!gFinanceLedger.empty())
 	{
-		// set node to list head
-		pFinanceNode=pFinanceList;
-
-		// set list head to next node
-		pFinanceList=pFinanceList->Next;
-
-		// delete current node
-		delete pFinanceNode;
+		fu.iMineIncomeToDate    = gFinanceLedger.back().iMineIncomeToDate;
+		fu.iOtherDepositsToDate = gFinanceLedger.back().iOtherDepositsToDate;
 	}
-	pFinanceListHead = NULL;
+	if (ubCode == DEPOSIT_FROM_GOLD_MINE || ubCode == DEPOSIT_FROM_SILVER_MINE)
+	{
+		fu.iMineIncomeToDate += iAmount;
+	}
+	else if (iAmount > 0)
+	{
+		fu.iOtherDepositsToDate += iAmount;
+	}
+
+	gFinanceLedger.push_back(fu);
 }
 
 
-static void ProcessAndEnterAFinancialRecord(const UINT8 ubCode, const UINT32 uiDate, const INT32 iAmount, const UINT8 ubSecondCode, const INT32 iBalanceToDate)
+// reads the records from the finance file, once after it has been replaced
+static std::vector<FinanceUnit> const& GetFinanceLedger(void)
 {
-	FinanceUnit* const fu = new FinanceUnit{};
-	fu->Next           = NULL;
-	fu->ubCode         = ubCode;
-	fu->ubSecondCode   = ubSecondCode;
-	fu->uiDate         = uiDate;
-	fu->iAmount        = iAmount;
-	fu->iBalanceToDate = iBalanceToDate;
-
-	// Append to end of list
-	FinanceUnit** i = &pFinanceListHead;
-	while (*i != NULL) i = &(*i)->Next;
-	*i = fu;
+	if (gfFinanceLedgerLoaded) return gFinanceLedger;
+	gfFinanceLedgerLoaded = true;
+
+	gFinanceLedger.clear();
+	if (!GCM->tempFiles()->exists(FINANCES_DATA_FILE)) return gFinanceLedger;
+
+	std::vector<UINT8> data;
+	{
+		AutoSGPFile f(GCM->tempFiles()->openForReading(FINANCES_DATA_FILE));
+		data = f->readToEnd();
+	}
+	if (data.size() < FINANCE_HEADER_SIZE) return gFinanceLedger;
+
+	size_t const records = (data.size() - FINANCE_HEADER_SIZE) / FINANCE_RECORD_SIZE;
+	gFinanceLedger.reserve(records);
+
+	DataReader d{data.data() + FINANCE_HEADER_SIZE};
+	for (size_t i = 0; i < records; ++i)
+	{
+		UINT8  code;
+		UINT8  second_code;
+		UINT32 date;
+		INT32  amount;
+		INT32  balance_to_date;
+		EXTR_U8(d, code);
+		EXTR_U8(d, second_code);
+		EXTR_U32(d, date);
+		EXTR_I32(d, amount);
+		EXTR_I32(d, balance_to_date);
+
+		EnterFinanceRecord(code, second_code, date, amount, balance_to_date);
+	}
+	Assert(d.getConsumed() == records * FINANCE_RECORD_SIZE);
+
+	return gFinanceLedger;
 }
 
 
@@ -883,40 +919,28 @@ static void GetBalanceFromDisk(void)
 
 
 // will write the current finance to disk
-static void AppendFinanceToEndOfFile(void)
+static void AppendFinanceToEndOfFile(FinanceUnit const& fu)
 {
 	AutoSGPFile f(GCM->tempFiles()->openForAppend(FINANCES_DATA_FILE));
 
-	const FinanceUnit* const fu = pFinanceListHead;
 	BYTE  data[FINANCE_RECORD_SIZE];
 	DataWriter d{data};
-	INJ_U8(d, fu->ubCode);
-	INJ_U8(d, fu->ubSecondCode);
-	INJ_U32(d, fu->uiDate);
-	INJ_I32(d, fu->iAmount);
-	INJ_I32(d, fu->iBalanceToDate);
+	INJ_U8(d, fu.ubCode);
+	INJ_U8(d, fu.ubSecondCode);
+	INJ_U32(d, fu.uiDate);
+	INJ_I32(d, fu.iAmount);
+	INJ_I32(d, fu.iBalanceToDate);
 	Assert(d.getConsumed() == lengthof(data));
 
 	f->write(data, sizeof(data));
 }
 
 
-// Grabs the size of the file and interprets number of pages it will take up
+// Interprets the number of records as the number of pages they will take up
 static void SetLastPageInRecords(void)
 {
-	AutoSGPFile f(GCM->tempFiles()->openForReading(FINANCES_DATA_FILE));
-
-	const UINT32 size = f->size();
-
-	if (size < FINANCE_HEADER_SIZE + FINANCE_RECORD_SIZE)
-	{
-		guiLastPageInRecordsList = 0;
-		return;
-	}
-
-	guiLastPageInRecordsList =
-		(size - FINANCE_HEADER_SIZE - FINANCE_RECORD_SIZE) /
-		(FINANCE_RECORD_SIZE * NUM_RECORDS_PER_PAGE);
+	size_t const records = GetFinanceLedger().size();
+	guiLastPageInRecordsList = records == 0 ? 0 : (records - 1) / NUM_RECORDS_PER_PAGE;
 }
 
 
@@ -934,48 +958,12 @@ static void LoadNextPage(void)
 }
 
 
-// Loads in records belonging to page
+// Shows the records belonging to page, page 0 is the summary
 static void LoadInRecords(UINT32 const page)
 {
 	iCurrentPage      = page;
 	fReDrawScreenFlag = TRUE;
 	SetFinanceButtonStates();
-	ClearFinanceList();
-	if (page == 0) return; // check if bad page
-
-	AutoSGPFile f(GCM->tempFiles()->openForReading(FINANCES_DATA_FILE));
-
-	UINT32 const size = f->size();
-	if (size < FINANCE_HEADER_SIZE) return;
-
-	UINT32       records      = (size - FINANCE_HEADER_SIZE) / FINANCE_RECORD_SIZE;
-	UINT32 const skip_records = NUM_RECORDS_PER_PAGE * (page - 1);
-	if (records <= skip_records) return;
-
-	records -= skip_records;
-	f->seek(FINANCE_HEADER_SIZE + FINANCE_RECORD_SIZE * skip_records, FILE_SEEK_FROM_START);
-
-	if (records > NUM_RECORDS_PER_PAGE) records = NUM_RECORDS_PER_PAGE;
-	for (; records > 0; --records)
-	{
-		BYTE data[FINANCE_RECORD_SIZE];
-		f->read(data, sizeof(data));
-
-		UINT8  code;
-		UINT8  second_code;
-		UINT32 date;
-		INT32  amount;
-		INT32  balance_to_date;
-		DataReader d{data};
-		EXTR_U8(d, code);
-		EXTR_U8(d, second_code);
-		EXTR_U32(d, date);
-		EXTR_I32(d, amount);
-		EXTR_I32(d, balance_to_date);
-		Assert(d.getConsumed() == lengthof(data));
-
-		ProcessAndEnterAFinancialRecord(code, date, amount, second_code, balance_to_date);
-	}
 }
 
 
@@ -1013,178 +1001,67 @@ static ST::string SPrintMoneyNoDollarOnZero(INT32 amount)
 }
 
 
-// find out what today is, then go back 2 days, get balance for that day
-static INT32 GetPreviousDaysBalance(void)
+// index one past the last record made on or before day
+static size_t EndOfDay(std::vector<FinanceUnit> const& ledger, UINT32 const day)
 {
-	const UINT32 date_in_minutes = GetWorldTotalMin() - 60 * 24;
-	const UINT32 date_in_days    = date_in_minutes / (24 * 60);
-
-	if (date_in_days < 2) return 0;
-
-	AutoSGPFile f(GCM->tempFiles()->openForReading(FINANCES_DATA_FILE));
-
-	INT32 balance = 0;
-	// start at the end, move back until Date / 24 * 60 on the record equals date_in_days - 2
-	// loop, make sure we don't pass beginning of file, if so, we have an error, and check for condifition above
-	for (UINT32 pos = f->size(); pos >= FINANCE_HEADER_SIZE + RECORD_SIZE;)
-	{
-		f->seek(pos -= RECORD_SIZE, FILE_SEEK_FROM_START);
+	auto const i = std::upper_bound(ledger.begin(), ledger.end(), day,
+		[](UINT32 const d, FinanceUnit const& fu) { return d < fu.uiDate / (24 * 60); });
+	return i - ledger.begin();
+}
 
-		BYTE data[RECORD_SIZE];
-		f->read(data, sizeof(data));
 
-		UINT32 date;
-		INT32 balance_to_date;
-		DataReader d{data};
-		EXTR_SKIP(d, 2);
-		EXTR_U32(d, date);
-		EXTR_SKIP(d, 4);
-		EXTR_I32(d, balance_to_date);
-		Assert(d.getConsumed() == lengthof(data));
+// the ending balance of day, 0 if there are no records for that day
+static INT32 GetBalanceAtEndOfDay(UINT32 const day)
+{
+	std::vector<FinanceUnit> const& ledger = GetFinanceLedger();
+	size_t const end = EndOfDay(ledger, day);
+	if (end == 0 || ledger[end - 1].uiDate / (24 * 60) != day) return 0;
+	return ledger[end - 1].iBalanceToDate;
+}
 
-		// check to see if we are far enough
-		if (date / (24 * 60) == date_in_days - 2)
-		{
-			balance = balance_to_date;
-			break;
-		}
 
-		// there are no entries for the previous day
-		if (date / (24 * 60) < date_in_days - 2) break;
-	}
-
-	return balance;
+// the difference of a running total over the records of day
+static INT32 GetDayTotal(UINT32 const day, INT32 FinanceUnit::* const total)
+{
+	std::vector<FinanceUnit> const& ledger = GetFinanceLedger();
+	size_t const begin = day == 0 ? 0 : EndOfDay(ledger, day - 1);
+	size_t const end   = EndOfDay(ledger, day);
+	if (begin == end) return 0;
+	return ledger[end - 1].*total - (begin == 0 ? 0 : ledger[begin - 1].*total);
 }
 
 
-static INT32 GetTodaysBalance(void)
+// find out what today is, then go back 2 days, get balance for that day
+static INT32 GetPreviousDaysBalance(void)
 {
-	const UINT32 date_in_minutes = GetWorldTotalMin();
+	const UINT32 date_in_minutes = GetWorldTotalMin() - 60 * 24;
 	const UINT32 date_in_days    = date_in_minutes / (24 * 60);
 
-	AutoSGPFile f(GCM->tempFiles()->openForReading(FINANCES_DATA_FILE));
-
-	INT32 balance = 0;
-	// loop, make sure we don't pass beginning of file, if so, we have an error, and check for condifition above
-	for (UINT32 pos = f->size(); pos >= FINANCE_HEADER_SIZE + RECORD_SIZE;)
-	{
-		f->seek(pos -= RECORD_SIZE, FILE_SEEK_FROM_START);
-
-		BYTE data[RECORD_SIZE];
-		f->read(data, sizeof(data));
+	if (date_in_days < 2) return 0;
 
-		UINT32 date;
-		INT32 balance_to_date;
-		DataReader d{data};
-		EXTR_SKIP(d, 2);
-		EXTR_U32(d, date);
-		EXTR_SKIP(d, 4);
-		EXTR_I32(d, balance_to_date);
-		Assert(d.getConsumed() == lengthof(data));
+	return GetBalanceAtEndOfDay(date_in_days - 2);
+}
 
-		// check to see if we are far enough
-		if (date / (24 * 60) == date_in_days - 1)
-		{
-			balance = balance_to_date;
-			break;
-		}
-	}
 
-	return balance;
+static INT32 GetTodaysBalance(void)
+{
+	const UINT32 date_in_days = GetWorldTotalMin() / (24 * 60);
+	return GetBalanceAtEndOfDay(date_in_days - 1);
 }
 
 
-/* will return the income from the previous day, which is todays starting
- * balance - yesterdays starting balance */
+// will return the income from the previous day
 static INT32 GetPreviousDaysIncome(void)
 {
-	const UINT32 date_in_minutes = GetWorldTotalMin();
-	const UINT32 date_in_days    = date_in_minutes / (24 * 60);
-
-	AutoSGPFile f(GCM->tempFiles()->openForReading(FINANCES_DATA_FILE));
-
-	INT32 iTotalPreviousIncome = 0;
-	// start at the end, move back until Date / 24 * 60 on the record is = date_in_days - 2
-	// loop, make sure we don't pass beginning of file, if so, we have an error, and check for condifition above
-	BOOLEAN fOkToIncrement = FALSE;
-	for (UINT32 pos = f->size(); pos >= FINANCE_HEADER_SIZE + RECORD_SIZE;)
-	{
-		f->seek(pos -= RECORD_SIZE, FILE_SEEK_FROM_START);
-
-		BYTE data[RECORD_SIZE];
-		f->read(data, sizeof(data));
-
-		UINT8  code;
-		UINT32 date;
-		INT32  amount;
-		DataReader d{data};
-		EXTR_U8(d, code);
-		EXTR_SKIP(d, 1);
-		EXTR_U32(d, date);
-		EXTR_I32(d, amount);
-		EXTR_SKIP(d, 4);
-		Assert(d.getConsumed() == lengthof(data));
-
-		// now ok to increment amount
-		if (date / (24 * 60) == date_in_days - 1) fOkToIncrement = TRUE;
-
-		if (fOkToIncrement && (code == DEPOSIT_FROM_GOLD_MINE || code == DEPOSIT_FROM_SILVER_MINE))
-		{
-			// increment total
-			iTotalPreviousIncome += amount;
-		}
-
-		// check to see if we are far enough
-		if (date / (24 * 60) <= date_in_days - 2) break;
-	}
-
-	return iTotalPreviousIncome;
+	const UINT32 date_in_days = GetWorldTotalMin() / (24 * 60);
+	return GetDayTotal(date_in_days - 1, &FinanceUnit::iMineIncomeToDate);
 }
 
 
 static INT32 GetTodaysDaysIncome(void)
 {
-	const UINT32 date_in_minutes = GetWorldTotalMin();
-	const UINT32 date_in_days    = date_in_minutes / (24 * 60);
-
-	AutoSGPFile f(GCM->tempFiles()->openForReading(FINANCES_DATA_FILE));
-
-	INT32 iTotalIncome = 0;
-	// loop, make sure we don't pass beginning of file, if so, we have an error, and check for condifition above
-	BOOLEAN fOkToIncrement = FALSE;
-	for (UINT32 pos = f->size(); pos >= FINANCE_HEADER_SIZE + RECORD_SIZE;)
-	{
-		f->seek(pos -= RECORD_SIZE, FILE_SEEK_FROM_START);
-
-		BYTE data[RECORD_SIZE];
-		f->read(data, sizeof(data));
-
-		UINT8  code;
-		UINT32 date;
-		INT32  amount;
-		DataReader d{data};
-		EXTR_U8(d, code);
-		EXTR_SKIP(d, 1);
-		EXTR_U32(d, date);
-		EXTR_I32(d, amount);
-		EXTR_SKIP(d, 4);
-		Assert(d.getConsumed() == lengthof(data));
-
-		// now ok to increment amount
-		if (date / (24 * 60) > date_in_days - 1) fOkToIncrement = TRUE;
-
-		if (fOkToIncrement && (code == DEPOSIT_FROM_GOLD_MINE || code == DEPOSIT_FROM_SILVER_MINE))
-		{
-			// increment total
-			iTotalIncome += amount;
-			fOkToIncrement = FALSE;
-		}
-
-		// check to see if we are far enough
-		if (date / (24 * 60) == date_in_days - 1) break;
-	}
-
-	return iTotalIncome;
+	const UINT32 date_in_days = GetWorldTotalMin() / (24 * 60);
+	return GetDayTotal(date_in_days, &FinanceUnit::iMineIncomeToDate);
 }
 
 
@@ -1205,97 +1082,15 @@ static void SetFinanceButtonStates(void)
 // grab todays other deposits
 static INT32 GetTodaysOtherDeposits(void)
 {
-	const UINT32 date_in_minutes = GetWorldTotalMin();
-	const UINT32 date_in_days    = date_in_minutes / (24 * 60);
-
-	AutoSGPFile f(GCM->tempFiles()->openForReading(FINANCES_DATA_FILE));
-
-	INT32 iTotalIncome = 0;
-	// loop, make sure we don't pass beginning of file, if so, we have an error, and check for condifition above
-	BOOLEAN fOkToIncrement = FALSE;
-	for (UINT32 pos = f->size(); pos >= FINANCE_HEADER_SIZE + RECORD_SIZE;)
-	{
-		f->seek(pos -= RECORD_SIZE, FILE_SEEK_FROM_START);
-
-		BYTE data[RECORD_SIZE];
-		f->read(data, sizeof(data));
-
-		UINT8  code;
-		UINT32 date;
-		INT32  amount;
-		DataReader d{data};
-		EXTR_U8(d, code);
-		EXTR_SKIP(d, 1);
-		EXTR_U32(d, date);
-		EXTR_I32(d, amount);
-		EXTR_SKIP(d, 4);
-		Assert(d.getConsumed() == lengthof(data));
-
-		// now ok to increment amount
-		if (date / (24 * 60) > date_in_days - 1) fOkToIncrement = TRUE;
-
-		if (fOkToIncrement &&
-				(code != DEPOSIT_FROM_GOLD_MINE && code != DEPOSIT_FROM_SILVER_MINE) &&
-				amount > 0)
-		{
-			// increment total
-			iTotalIncome += amount;
-			fOkToIncrement = FALSE;
-		}
-
-		// check to see if we are far enough
-		if (date / (24 * 60) == date_in_days - 1) break;
-	}
-
-	return iTotalIncome;
+	const UINT32 date_in_days = GetWorldTotalMin() / (24 * 60);
+	return GetDayTotal(date_in_days, &FinanceUnit::iOtherDepositsToDate);
 }
 
 
 static INT32 GetYesterdaysOtherDeposits(void)
 {
-	const UINT32 iDateInMinutes = GetWorldTotalMin();
-	const UINT32 date_in_days   = iDateInMinutes / (24 * 60);
-
-	AutoSGPFile f(GCM->tempFiles()->openForReading(FINANCES_DATA_FILE));
-
-	INT32 iTotalPreviousIncome = 0;
-	// start at the end, move back until Date / 24 * 60 on the record is =  date_in_days - 2
-	// loop, make sure we don't pass beginning of file, if so, we have an error, and check for condifition above
-	BOOLEAN fOkToIncrement = FALSE;
-	for (UINT32 pos = f->size(); pos >= FINANCE_HEADER_SIZE + RECORD_SIZE;)
-	{
-		f->seek(pos -= RECORD_SIZE, FILE_SEEK_FROM_START);
-
-		BYTE data[RECORD_SIZE];
-		f->read(data, sizeof(data));
-
-		UINT8  code;
-		UINT32 date;
-		INT32  amount;
-		DataReader d{data};
-		EXTR_U8(d, code);
-		EXTR_SKIP(d, 1);
-		EXTR_U32(d, date);
-		EXTR_I32(d, amount);
-		EXTR_SKIP(d, 4);
-		Assert(d.getConsumed() == lengthof(data));
-
-		// now ok to increment amount
-		if (date / (24 * 60) == date_in_days - 1) fOkToIncrement = TRUE;
-
-		if (fOkToIncrement &&
-				(code != DEPOSIT_FROM_GOLD_MINE && code != DEPOSIT_FROM_SILVER_MINE) &&
-				amount > 0)
-		{
-			// increment total
-			iTotalPreviousIncome += amount;
-		}
-
-		// check to see if we are far enough
-		if (date / (24 * 60) <= date_in_days - 2) break;
-	}
-
-	return iTotalPreviousIncome;
+	const UINT32 date_in_days = GetWorldTotalMin() / (24 * 60);
+	return GetDayTotal(date_in_days - 1, &FinanceUnit::iOtherDepositsToDate);
 }
 
 
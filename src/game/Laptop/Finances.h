@@ -10,6 +10,9 @@ void EnterFinances(void);
 void ExitFinances(void);
 void RenderFinances(void);
 
+// Drops the records kept in memory, call after FINANCES_DATA_FILE was replaced
+void ResetFinancesLedger(void);
+
 #define FINANCES_DATA_FILE "finances.dat"
 
 enum
@@ -24,6 +24,9 @@
 #include <string_theory/format>
 #include <string_theory/string>
 
+#include <algorithm>
+#include <vector>
+
 
 #define HISTORY_QUEST_TEXT_SIZE 80
 
@@ -34,7 +37,6 @@ struct HistoryUnit
 	UINT8 ubSecondCode; // secondary code
 	UINT32 uiDate; // time in the world in global time
 	SGPSector sSector; // sector this took place in
-	HistoryUnit* Next; // next unit in the list
 };
 
 
@@ -88,35 +90,41 @@ static BOOLEAN fInHistoryMode = FALSE;
 static INT32 iCurrentHistoryPage = 1;
 
 
-// the History record list
-static HistoryUnit* pHistoryListHead = NULL;
-
+// All records of HISTORY_DATA_FILE in the order they were made.  The file
+// is only read once after it has been replaced, every new record is appended
+// to both.
+static std::vector<HistoryUnit> gHistoryLedger;
+static bool gfHistoryLedgerLoaded = false;
 
-void ClearHistoryList( void );
 
-
-static void AppendHistoryToEndOfFile(void);
+static void AppendHistoryToEndOfFile(const HistoryUnit&);
 static BOOLEAN LoadInHistoryRecords(const UINT32 uiPage);
-static void ProcessAndEnterAHistoryRecord(UINT8 ubCode, UINT32 uiDate, UINT8 ubSecondCode, const SGPSector& sSector);
+static const std::vector<HistoryUnit>& GetHistoryLedger(void);
 
 
 void AddHistoryToPlayersLog(const UINT8 ubCode, const UINT8 ubSecondCode, const UINT32 uiDate, const SGPSector& sSector)
 {
-	ClearHistoryList();
+	// the ledger has to be read before the file gets the new record
+	GetHistoryLedger();
 
-	ProcessAndEnterAHistoryRecord(ubCode, uiDate, ubSecondCode, sSector);
+	gHistoryLedger.push_back(HistoryUnit{ ubCode, ubSecondCode, uiDate, sSector });
 	ScreenMsg(FONT_MCOLOR_LTYELLOW, MSG_INTERFACE, pMessageStrings[MSG_HISTORY_UPDATED]);
 
-	AppendHistoryToEndOfFile();
-
-	// if in history mode, reload current page
-	if (fInHistoryMode) LoadInHistoryRecords(iCurrentHistoryPage);
+	AppendHistoryToEndOfFile(gHistoryLedger.back());
 }
 
 
 void GameInitHistory()
 {
 	GCM->tempFiles()->deleteFile(HISTORY_DATA_FILE);
+	ResetHistoryLedger();
+}
+
+
+void ResetHistoryLedger(void)
+{
+	gHistoryLedger.clear();
+	gfHistoryLedgerLoaded = false;
 }
 
 
@@ -173,8 +181,6 @@ void ExitHistory()
 
 	// delete buttons
 	DestroyHistoryButtons( );
-
-	ClearHistoryList( );
 }
 
 
@@ -317,58 +323,50 @@ static void BtnHistoryDisplayNextPageCallBack(GUI_BUTTON* btn, UINT32 reason)
 }
 
 
-static void ProcessAndEnterAHistoryRecord(const UINT8 ubCode, const UINT32 uiDate, const UINT8 ubSecondCode, const SGPSector& sSector)
+// reads the records from the history file, once after it has been replaced
+static const std::vector<HistoryUnit>& GetHistoryLedger(void)
 {
-	HistoryUnit* const h = new HistoryUnit{};
-	h->Next         = NULL;
-	h->ubCode       = ubCode;
-	h->ubSecondCode = ubSecondCode;
-	h->uiDate       = uiDate;
-	h->sSector      = sSector;
+	if (gfHistoryLedgerLoaded) return gHistoryLedger;
+	gfHistoryLedgerLoaded = true;
 
-	// Append node to list
-	HistoryUnit** anchor = &pHistoryListHead;
-	while (*anchor != NULL) anchor = &(*anchor)->Next;
-	*anchor = h;
-}
+	gHistoryLedger.clear();
+	if (!GCM->tempFiles()->exists(HISTORY_DATA_FILE)) return gHistoryLedger;
 
-// open and read in data to the History list
-static void OpenAndReadHistoryFile(void)
-{
-	ClearHistoryList();
+	std::vector<UINT8> data;
+	{
+		AutoSGPFile f(GCM->tempFiles()->openForReading(HISTORY_DATA_FILE));
+		data = f->readToEnd();
+	}
 
-	AutoSGPFile f(GCM->tempFiles()->openForReading(HISTORY_DATA_FILE));
+	const size_t entry_count = data.size() / SIZE_OF_HISTORY_FILE_RECORD;
+	gHistoryLedger.reserve(entry_count);
 
-	UINT entry_count = f->size() / SIZE_OF_HISTORY_FILE_RECORD;
-	while (entry_count-- > 0)
+	DataReader d{data.data()};
+	for (size_t i = 0; i < entry_count; ++i)
 	{
-		UINT8  ubCode;
-		UINT8  ubSecondCode;
-		UINT32 uiDate;
-		SGPSector sSector;
-
-		f->read(&ubCode,       sizeof(UINT8));
-		f->read(&ubSecondCode, sizeof(UINT8));
-		f->read(&uiDate,       sizeof(UINT32));
-		f->read(&sSector.x,    sizeof(INT16));
-		f->read(&sSector.y,    sizeof(INT16));
-		f->read(&sSector.z,    sizeof(INT8));
-		f->seek(1, FILE_SEEK_FROM_CURRENT);
-
-		ProcessAndEnterAHistoryRecord(ubCode, uiDate, ubSecondCode, sSector);
+		HistoryUnit h;
+		EXTR_U8(d, h.ubCode)
+		EXTR_U8(d, h.ubSecondCode)
+		EXTR_U32(d, h.uiDate)
+		EXTR_I16(d, h.sSector.x)
+		EXTR_I16(d, h.sSector.y)
+		EXTR_I8(d, h.sSector.z)
+		EXTR_SKIP(d, 1)
+		gHistoryLedger.push_back(h);
 	}
+	Assert(d.getConsumed() == entry_count * SIZE_OF_HISTORY_FILE_RECORD);
+
+	return gHistoryLedger;
 }
 
 
-void ClearHistoryList(void)
+// the range of records shown on the current page
+static void GetHistoryPageRange(size_t& first, size_t& last)
 {
-	for (HistoryUnit* h = pHistoryListHead; h != NULL;)
-	{
-		HistoryUnit* const next = h->Next;
-		delete h;
-		h = next;
-	}
-	pHistoryListHead = NULL;
+	const size_t count = GetHistoryLedger().size();
+	first = iCurrentHistoryPage > 0 ? (iCurrentHistoryPage - 1) * NUM_RECORDS_PER_PAGE : count;
+	first = std::min(first, count);
+	last  = std::min(first + NUM_RECORDS_PER_PAGE, count);
 }
 
 
@@ -428,16 +426,19 @@ static void DrawHistoryRecordsText(void)
 	SetFontBackground(FONT_BLACK);
 	SetFontShadow(NO_SHADOW);
 
-	UINT entry_count = 0;
-	for (const HistoryUnit* h = pHistoryListHead; h != NULL; h = h->Next)
+	size_t first;
+	size_t last;
+	GetHistoryPageRange(first, last);
+	for (size_t i = first; i != last; ++i)
 	{
+		const HistoryUnit* const h = &GetHistoryLedger()[i];
 		const UINT8 colour =
 			h->ubCode  == HISTORY_CHEAT_ENABLED ||
 			(h->ubCode == HISTORY_QUEST_STARTED && gubQuest[h->ubSecondCode] == QUESTINPROGRESS) ?
 				FONT_RED : FONT_BLACK;
 		SetFontForeground(colour);
 
-		const INT32 y = RECORD_Y + entry_count * BOX_HEIGHT + 3;
+		const INT32 y = RECORD_Y + static_cast<INT32>(i - first) * BOX_HEIGHT + 3;
 
 		// get and write the date
 		sString = ST::format("{}", h->uiDate / (24 * 60));
@@ -463,8 +464,6 @@ static void DrawHistoryRecordsText(void)
 		// the actual history text
 		sString = ProcessHistoryTransactionString(h);
 		MPrint(RECORD_DATE_X + RECORD_LOCATION_WIDTH + RECORD_DATE_WIDTH + 15, y, sString);
-
-		if (++entry_count == NUM_RECORDS_PER_PAGE) break;
 	}
 
 	// restore shadow
@@ -517,8 +516,10 @@ static void DisplayPageNumberAndDateRange(void)
 	UINT count_pages;
 	UINT first_date;
 	UINT last_date;
-	const HistoryUnit* h = pHistoryListHead;
-	if (h == NULL)
+	size_t first;
+	size_t last;
+	GetHistoryPageRange(first, last);
+	if (first == last)
 	{
 		current_page = 1;
 		count_pages  = 1;
@@ -529,12 +530,8 @@ static void DisplayPageNumberAndDateRange(void)
 	{
 		current_page     = iCurrentHistoryPage;
 		count_pages      = GetNumberOfHistoryPages();
-		first_date       = h->uiDate / (24 * 60);
-
-		UINT entry_count = NUM_RECORDS_PER_PAGE;
-		while (--entry_count != 0 && h->Next != NULL) h = h->Next;
-
-		last_date        = h->uiDate / (24 * 60);
+		first_date       = GetHistoryLedger()[first].uiDate    / (24 * 60);
+		last_date        = GetHistoryLedger()[last - 1].uiDate / (24 * 60);
 	}
 
 	SetFontAttributes(HISTORY_TEXT_FONT, FONT_BLACK, NO_SHADOW);
@@ -662,47 +659,14 @@ static void SetHistoryButtonStates(void)
 }
 
 
-// loads in records belogning, to page uiPage
+// checks whether there are records belonging to page uiPage
 static BOOLEAN LoadInHistoryRecords(const UINT32 uiPage)
-try
 {
-	ClearHistoryList();
-
 	// check if bad page
 	if (uiPage == 0) return FALSE;
 
-	AutoSGPFile f(GCM->tempFiles()->openForReading(HISTORY_DATA_FILE));
-
-	UINT       entry_count = f->size() / SIZE_OF_HISTORY_FILE_RECORD;
-	UINT const skip        = (uiPage - 1) * NUM_RECORDS_PER_PAGE;
-	if (entry_count <= skip) return FALSE;
-
-	f->seek(skip * SIZE_OF_HISTORY_FILE_RECORD, FILE_SEEK_FROM_START);
-	entry_count -= skip;
-
-	if (entry_count > NUM_RECORDS_PER_PAGE) entry_count = NUM_RECORDS_PER_PAGE;
-
-	while (entry_count-- > 0)
-	{
-		UINT8  ubCode;
-		UINT8  ubSecondCode;
-		UINT32 uiDate;
-		SGPSector sSector;
-
-		f->read(&ubCode,       sizeof(UINT8));
-		f->read(&ubSecondCode, sizeof(UINT8));
-		f->read(&uiDate,       sizeof(UINT32));
-		f->read(&sSector.x,    sizeof(INT16));
-		f->read(&sSector.y,    sizeof(INT16));
-		f->read(&sSector.z,    sizeof(INT8));
-		f->seek(1, FILE_SEEK_FROM_CURRENT);
-
-		ProcessAndEnterAHistoryRecord(ubCode, uiDate, ubSecondCode, sSector);
-	}
-
-	return TRUE;
+	return (uiPage - 1) * NUM_RECORDS_PER_PAGE < GetHistoryLedger().size();
 }
-catch (...) { return FALSE; }
 
 
 // clear out old list of records, and load in next page worth of records
@@ -732,20 +696,18 @@ static void LoadPreviousHistoryPage(void)
 }
 
 
-static void AppendHistoryToEndOfFile(void)
+static void AppendHistoryToEndOfFile(const HistoryUnit& h)
 {
 	AutoSGPFile f(GCM->tempFiles()->openForAppend(HISTORY_DATA_FILE));
 
-	const HistoryUnit* const h = pHistoryListHead;
-
 	BYTE  data[12];
 	DataWriter d{data};
-	INJ_U8(d, h->ubCode)
-	INJ_U8(d, h->ubSecondCode)
-	INJ_U32(d, h->uiDate)
-	INJ_I16(d, h->sSector.x)
-	INJ_I16(d, h->sSector.y)
-	INJ_I8(d, h->sSector.z)
+	INJ_U8(d, h.ubCode)
+	INJ_U8(d, h.ubSecondCode)
+	INJ_U32(d, h.uiDate)
+	INJ_I16(d, h.sSector.x)
+	INJ_I16(d, h.sSector.y)
+	INJ_I8(d, h.sSector.z)
 	INJ_SKIP(d, 1)
 	Assert(d.getConsumed() == lengthof(data));
 
@@ -755,22 +717,14 @@ static void AppendHistoryToEndOfFile(void)
 
 UINT32 GetTimeQuestWasStarted(const UINT8 ubCode)
 {
-	iCurrentHistoryPage = 0;
-	OpenAndReadHistoryFile();
-
-	UINT32 uiTime = 0;
-	for (const HistoryUnit* h = pHistoryListHead; h != NULL; h = h->Next)
+	for (const HistoryUnit& h : GetHistoryLedger())
 	{
-		if (h->ubSecondCode == ubCode && h->ubCode == HISTORY_QUEST_STARTED)
+		if (h.ubSecondCode == ubCode && h.ubCode == HISTORY_QUEST_STARTED)
 		{
-			uiTime = h->uiDate;
-			break;
+			return h.uiDate;
 		}
 	}
-
-	if (fInHistoryMode) LoadInHistoryRecords(iCurrentHistoryPage);
-
-	return uiTime;
+	return 0;
 }
 
 
@@ -789,11 +743,9 @@ static ST::string GetQuestEndedString(const UINT8 ubQuestValue)
 
 static INT32 GetNumberOfHistoryPages(void)
 {
-	AutoSGPFile f(GCM->tempFiles()->openForReading(HISTORY_DATA_FILE));
-
-	const UINT32 uiFileSize = f->size();
+	const size_t entry_count = GetHistoryLedger().size();
 
-	if (uiFileSize == 0) return 1;
+	if (entry_count == 0) return 1;
 
-	return (uiFileSize / SIZE_OF_HISTORY_FILE_RECORD + NUM_RECORDS_PER_PAGE - 1) / NUM_RECORDS_PER_PAGE;
+	return (entry_count + NUM_RECORDS_PER_PAGE - 1) / NUM_RECORDS_PER_PAGE;
 }
@@ -8,6 +8,9 @@ void EnterHistory(void);
 void ExitHistory(void);
 void RenderHistory(void);
 
+// Drops the records kept in memory, call after HISTORY_DATA_FILE was replaced
+void ResetHistoryLedger(void);
+
 
 #define HISTORY_DATA_FILE "history.dat"
 
@@ -315,8 +315,6 @@ void PrintBalance(void);
 void PrintDate(void);
 void PrintNumberOnTeam(void);
 
-extern void ClearHistoryList(void);
-
 
 void SetLaptopExitScreen(ScreenID const uiExitScreen)
 {
@@ -404,7 +402,7 @@ void LaptopScreenShutdown(void)
 	InsuranceContractEndGameShutDown();
 	BobbyRayMailOrderEndGameShutDown();
 	ShutDownEmailList();
-	ClearHistoryList();
+	ResetHistoryLedger();
 }
 
 
@@ -3251,6 +3249,8 @@ void ClearOutTempLaptopFiles(void)
 	GCM->tempFiles()->deleteFile(FILES_DATA_FILE);
 	GCM->tempFiles()->deleteFile(FINANCES_DATA_FILE);
 	GCM->tempFiles()->deleteFile(HISTORY_DATA_FILE);
+	ResetFinancesLedger();
+	ResetHistoryLedger();
 }
 
 
@@ -80,17 +80,12 @@ static void SaveEMailIntoFile(HWFILE const File, Email const* const Mail)
 
 void SaveEmailToSavedGame(HWFILE const File)
 {
-	const Email* pEmail;
+	std::vector<Email*> const& mails = GetEmailList();
 
-	// Count the emails
-	UINT32 uiNumOfEmails = 0;
-	for (pEmail = pEmailList; pEmail != NULL; pEmail = pEmail->Next)
-	{
-		uiNumOfEmails++;
-	}
+	UINT32 const uiNumOfEmails = static_cast<UINT32>(mails.size());
 	File->write(&uiNumOfEmails, sizeof(UINT32));
 
-	for (pEmail = pEmailList; pEmail != NULL; pEmail = pEmail->Next)
+	for (const Email* pEmail : mails)
 	{
 		SaveEMailIntoFile(File, pEmail);
 	}
@@ -35,6 +35,7 @@
 #include "IMP_Compile_Character.h"
 #include "IMP_Confirm.h"
 #include "IMP_Portraits.h"
+#include "InputRecorder.h"
 #include "Interface_Dialogue.h"
 #include "Interface_Items.h"
 #include "Interface_Panels.h"
@@ -627,6 +628,34 @@ static void TruncateStrategicGroupSizes(void);
 static void UpdateMercMercContractInfo(void);
 void InitScriptingEngine();
 
+/* While recording the input, the loaded save is embedded in the recording.  A
+ * replay loads the embedded save instead of whatever is in the slot now. */
+static SGPFile* OpenSavedGameForLoading(const ST::string &saveName)
+{
+	if (InputRecorder::IsReplaying())
+	{
+		std::vector<uint8_t> data;
+		if (InputRecorder::ReplayLoadedFile(data))
+		{
+			const ST::string replayFilename("replay.sav");
+			{
+				AutoSGPFile f(GCM->tempFiles()->openForWriting(replayFilename));
+				f->write(data.data(), data.size());
+			}
+			return GCM->tempFiles()->openForReading(replayFilename);
+		}
+		SLOGW("The input recording has no saved game embedded, loading '{}'", saveName);
+	}
+
+	ST::string savegameFilename = GetSaveGamePath(saveName);
+	if (InputRecorder::IsRecording())
+	{
+		AutoSGPFile f(GCM->saveGameFiles()->openForReading(savegameFilename));
+		InputRecorder::RecordLoadedFile(f->readToEnd());
+	}
+	return GCM->saveGameFiles()->openForReading(savegameFilename);
+}
+
 void LoadSavedGame(const ST::string &saveName)
 {
 	// Save the game before if we are in Dead is Dead Mode
@@ -674,8 +703,7 @@ void LoadSavedGame(const ST::string &saveName)
 	// ATE: Added to empty dialogue q
 	EmptyDialogueQueue();
 
-	ST::string savegameFilename = GetSaveGamePath(saveName);
-	AutoSGPFile f(GCM->saveGameFiles()->openForReading(savegameFilename));
+	AutoSGPFile f(OpenSavedGameForLoading(saveName));
 
 	SAVED_GAME_HEADER SaveGameHeader;
 	bool stracLinuxFormat;
@@ -767,9 +795,11 @@ void LoadSavedGame(const ST::string &saveName)
 
 	BAR(1, "Finances Data File...");
 	LoadFilesFromSavedGame(FINANCES_DATA_FILE, f);
+	ResetFinancesLedger();
 
 	BAR(1, "History File...");
 	LoadFilesFromSavedGame(HISTORY_DATA_FILE, f);
+	ResetHistoryLedger();
 
 	BAR(1, "The Laptop FILES file...");
 	LoadFilesFromSavedGame(FILES_DATA_FILE, f);
@@ -1406,6 +1436,7 @@ static void LoadSoldierStructure(HWFILE const f, UINT32 savegame_version, bool s
 			{
 				// turn off neutral flag
 				s->bNeutral = FALSE;
+				UpdateSoldierHotState(*s);
 			}
 		}
 		// JA2Gold: fix next-to-previous attacker value
@@ -1,5 +1,7 @@
 #include "Auto_Resolve.h"
+#include "Auto_Resolve_Prediction.h"
 #include "Campaign.h"
+#include "Cheats.h"
 #include "ContentManager.h"
 #include "Creature_Spreading.h"
 #include "Cursors.h"
@@ -2275,6 +2277,38 @@ static void CalculateRowsAndColumns(void)
 }
 
 
+// Number of simulations run for a prediction of the outcome of the battle
+#define AUTORESOLVE_PREDICTION_RUNS 1000
+
+
+static void PredictBattleOutcome()
+{
+	std::vector<AutoResolveCombatant> combatants;
+	auto add = [&](SOLDIERCELL const& cell, bool const player_side)
+	{
+		if (cell.uiFlags & CELL_RETREATED || !cell.pSoldier->bLife) return;
+		AutoResolveCombatant c;
+		AutoResolveCombatantFromSoldier(c, *cell.pSoldier);
+		c.fPlayerSide  = player_side;
+		c.fEPC         = (cell.uiFlags & CELL_EPC) != 0;
+		c.fCreature    = (cell.uiFlags & CELL_CREATURE) != 0;
+		c.usAttack     = cell.usAttack;
+		c.usDefence    = cell.usDefence;
+		c.usNextAttack = cell.usNextAttack;
+		combatants.push_back(c);
+	};
+	FOR_EACH_AR_MERC(i)  add(*i, true);
+	FOR_EACH_AR_CIV(i)   add(*i, true);
+	FOR_EACH_AR_ENEMY(i) add(*i, false);
+
+	UINT32 const start = GetClock();
+	AutoResolvePrediction const p = PredictAutoResolve(combatants, AUTORESOLVE_PREDICTION_RUNS);
+	SLOGI("Auto resolve prediction ({} runs in {} ms): {}% win chance, {.1f} player and {.1f} enemy casualties, {.0f} player and {.0f} enemy rounds fired",
+		p.uiSimulations, GetClock() - start, (int)(p.dPlayerWinChance * 100),
+		p.dPlayerCasualties, p.dEnemyCasualties, p.dPlayerRoundsFired, p.dEnemyRoundsFired);
+}
+
+
 static void HandleAutoResolveInput(void)
 {
 	InputAtom InputEvent;
@@ -2288,6 +2322,13 @@ static void HandleAutoResolveInput(void)
 					DepressAutoButton(gpAR->fPaused ? PLAY_BUTTON : PAUSE_BUTTON);
 					break;
 
+				case 'p':
+					if( _KeyDown( ALT ) && CHEATER_CHEAT_LEVEL() )
+					{
+						PredictBattleOutcome();
+					}
+					break;
+
 				case 'x':
 					if( _KeyDown( ALT ) )
 					{
@@ -0,0 +1,416 @@
+#include "Auto_Resolve_Prediction.h"
+#include "Animation_Data.h"
+#include "ContentManager.h"
+#include "GameInstance.h"
+#include "ItemModel.h"
+#include "Items.h"
+#include "MagazineModel.h"
+#include "Overhead_Types.h"
+#include "Random.h"
+#include "SkillCheck.h"
+#include "Soldier_Control.h"
+#include "WeaponModels.h"
+#include "Weapons.h"
+
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <thread>
+
+
+// The battle is given up as a draw after this much battle time, e.g. if both
+// sides are down to combatants without any attack
+#define MAX_PREDICTION_BATTLE_TIME (4 * 60 * 60 * 1000)
+
+
+void AutoResolveCombatantFromSoldier(AutoResolveCombatant& c, SOLDIERTYPE const& s)
+{
+	c.bLife           = s.bLife;
+	c.fClaws          = s.ubBodyType == ADULTFEMALEMONSTER || s.ubBodyType == YAF_MONSTER;
+	c.fSpit           = s.ubBodyType == AM_MONSTER         || s.ubBodyType == YAM_MONSTER;
+	c.usRounds        = 0;
+	c.ubGunImpact     = 0;
+	c.ubArmourPercent = (UINT8)std::clamp(int(ArmourPercent(&s)), 0, 100);
+
+	switch (s.ubBodyType)
+	{
+		case YAF_MONSTER:
+		case YAM_MONSTER:        c.ubDamageDivisor = 4; break;
+		case ADULTFEMALEMONSTER:
+		case AM_MONSTER:         c.ubDamageDivisor = 6; break;
+		case QUEENMONSTER:       c.ubDamageDivisor = 8; break;
+		default:                 c.ubDamageDivisor = 1; break;
+	}
+
+	if (c.fSpit)
+	{
+		c.ubGunImpact = GCM->getWeapon(s.inv[SECONDHANDPOS].usItem)->ubImpact;
+	}
+	else
+	{
+		// Auto resolve fires the first gun in the inventory which has rounds left,
+		// but only the gun in hand gets reloaded.
+		CFOR_EACH_SOLDIER_INV_SLOT(i, s)
+		{
+			if (GCM->getItem(i->usItem)->getItemClass() != IC_GUN) continue;
+			if (!c.ubGunImpact || (i == &s.inv[HANDPOS] && i->ubGunShotsLeft))
+			{
+				c.ubGunImpact = GCM->getWeapon(i->usItem)->ubImpact;
+			}
+			c.usRounds += i->ubGunShotsLeft;
+		}
+
+		OBJECTTYPE const& hand = s.inv[HANDPOS];
+		if (GCM->getItem(hand.usItem)->getItemClass() == IC_GUN)
+		{
+			WeaponModel const* const gun = GCM->getWeapon(hand.usItem);
+			CFOR_EACH_SOLDIER_INV_SLOT(i, s)
+			{
+				ItemModel const* const item = GCM->getItem(i->usItem);
+				if (!item->isAmmo() || !gun->matches(item->asAmmo()->calibre)) continue;
+				for (UINT8 n = 0; n != i->ubNumberOfObjects; ++n)
+				{
+					c.usRounds += i->ubShotsLeft[n];
+				}
+			}
+		}
+	}
+
+	// Same as HTHImpact() without the skill traits and the random factors
+	UINT16 weapon = NOTHING;
+	INT8 const blade = FindObjClass(&s, IC_BLADE);
+	if (c.fClaws)
+	{
+		weapon = s.inv[HANDPOS].usItem;
+	}
+	else if (blade != NO_SLOT)
+	{
+		weapon = s.inv[blade].usItem;
+	}
+	c.fBlade = c.fClaws || blade != NO_SLOT;
+
+	INT32 impact = EffectiveExpLevel(&s) / 2;
+	if (c.fBlade)
+	{
+		impact += EffectiveStrength(&s) / 20;
+		if (weapon != NOTHING) impact += GCM->getWeapon(weapon)->ubImpact;
+	}
+	else
+	{
+		impact += EffectiveStrength(&s) / 5 + 5;
+	}
+	c.ubMeleeImpact = (UINT8)std::clamp(impact, 0, 255);
+}
+
+
+namespace
+{
+struct SimCombatant : AutoResolveCombatant
+{
+	UINT16 usNextHit[3];
+	UINT16 usHitDamage[3];
+};
+
+struct SimOutcome
+{
+	bool   fPlayerWon;
+	UINT32 uiPlayerCasualties;
+	UINT32 uiEnemyCasualties;
+	UINT32 uiPlayerRoundsFired;
+	UINT32 uiEnemyRoundsFired;
+};
+
+class BattleSimulation
+{
+	public:
+		BattleSimulation(std::vector<AutoResolveCombatant> const& combatants, UINT32 const seed) :
+			m_engine(seed)
+		{
+			m_cells.reserve(combatants.size());
+			for (AutoResolveCombatant const& c : combatants)
+			{
+				SimCombatant cell{};
+				static_cast<AutoResolveCombatant&>(cell) = c;
+				m_cells.push_back(cell);
+			}
+			m_order.resize(m_cells.size());
+			for (size_t i = 0; i != m_order.size(); ++i) m_order[i] = i;
+		}
+
+		SimOutcome Run();
+
+	private:
+		// Same as PreRandom(), but on the stream of this simulation
+		UINT32 Rnd(UINT32 const range)
+		{
+			if (range == 0) return 0;
+			return std::uniform_int_distribution<UINT32>(0, range - 1)(m_engine);
+		}
+
+		void Fight();
+		bool IsBattleOver();
+		void ResetNextAttackCounter(SimCombatant&);
+		SimCombatant* ChooseTarget(SimCombatant const& attacker);
+		void AttackTarget(SimCombatant& attacker, SimCombatant& target);
+		INT32 GunImpact(SimCombatant const& attacker, SimCombatant const& target, INT32 accuracy);
+		void TargetHit(SimCombatant& target, INT32 index);
+
+		std::mt19937              m_engine;
+		std::vector<SimCombatant> m_cells;
+		std::vector<size_t>       m_order;
+		SimOutcome                m_outcome{};
+};
+}
+
+
+bool BattleSimulation::IsBattleOver()
+{
+	bool player_fights = false;
+	bool enemy_fights  = false;
+	for (SimCombatant const& c : m_cells)
+	{
+		if (c.bLife == 0) continue;
+		if (!c.fPlayerSide)
+		{
+			enemy_fights = true;
+		}
+		else if (!c.fEPC)
+		{
+			player_fights = true;
+		}
+	}
+	if (player_fights && enemy_fights) return false;
+
+	m_outcome.fPlayerWon = !enemy_fights;
+	return true;
+}
+
+
+void BattleSimulation::ResetNextAttackCounter(SimCombatant& c)
+{
+	c.usNextAttack = std::min(1000 - c.usAttack, 800);
+	c.usNextAttack = (UINT16)(1000 + c.usNextAttack * 5 + Rnd(2000 - c.usAttack));
+	if (c.fCreature) c.usNextAttack = c.usNextAttack * 8 / 10;
+}
+
+
+SimCombatant* BattleSimulation::ChooseTarget(SimCombatant const& attacker)
+{
+	// Pick a living opponent with a chance proportional to his defence
+	UINT32 total_defence = 0;
+	SimCombatant* fallback = 0;
+	for (SimCombatant& c : m_cells)
+	{
+		if (c.fPlayerSide == attacker.fPlayerSide || c.bLife == 0) continue;
+		total_defence += c.usDefence;
+		if (!fallback) fallback = &c;
+	}
+
+	UINT32 pick = Rnd(total_defence);
+	for (SimCombatant& c : m_cells)
+	{
+		if (c.fPlayerSide == attacker.fPlayerSide || c.bLife == 0) continue;
+		if (pick < c.usDefence) return &c;
+		pick -= c.usDefence;
+	}
+	return fallback;
+}
+
+
+INT32 BattleSimulation::GunImpact(SimCombatant const& attacker, SimCombatant const& target, INT32 const accuracy)
+{
+	// Condensed BulletImpact(): random factors, armour and hit location
+	UINT32 const location = Rnd(100);
+	INT32 const fluke = Rnd(51) - 25;
+	INT32 const orig  = std::max(attacker.ubGunImpact * (100 + fluke + accuracy / 2) / 100, 1);
+	INT32 impact = std::max(orig * (100 - target.ubArmourPercent) / 100, (orig + 5) / 10);
+	if (location < 15)
+	{
+		impact = impact * 3 / 2;
+	}
+	else if (location < 30)
+	{
+		impact = impact / 2 / 2;
+	}
+	return impact;
+}
+
+
+void BattleSimulation::AttackTarget(SimCombatant& attacker, SimCombatant& target)
+{
+	UINT16 usAttack = attacker.usAttack < 950 ?
+		(UINT16)(attacker.usAttack + Rnd(1000 - attacker.usAttack)) :
+		(UINT16)(950 + Rnd(50));
+	UINT16 const defence = target.usDefence < 950 ?
+		(UINT16)(target.usDefence + Rnd(1000 - target.usDefence)) :
+		(UINT16)(950 + Rnd(50));
+
+	bool melee = attacker.fClaws;
+	if (!melee && !attacker.fSpit)
+	{
+		if (attacker.ubGunImpact && attacker.usRounds)
+		{
+			--attacker.usRounds;
+			++(attacker.fPlayerSide ? m_outcome.uiPlayerRoundsFired : m_outcome.uiEnemyRoundsFired);
+		}
+		else
+		{
+			melee = true;
+			if (target.ubGunImpact && target.usRounds && !attacker.fCreature)
+			{ // Penalty to attack with melee weapons against target with loaded gun.
+				usAttack = usAttack * (attacker.fBlade ? 6 : 4) / 10;
+			}
+		}
+	}
+
+	// Set up a delay for the hit or miss
+	INT32 index = -1;
+	if (!melee)
+	{
+		for (INT32 i = 0; i != 3; ++i)
+		{
+			if (target.usNextHit[i]) continue;
+			index = i;
+			target.usNextHit[i]   = (UINT16)(50 + Rnd(400));
+			target.usHitDamage[i] = 0;
+			break;
+		}
+	}
+
+	if (usAttack < defence && (target.bLife >= OKLIFE || !Rnd(5))) return;
+
+	INT32 const accuracy = (usAttack - defence + Rnd(defence - target.usDefence)) / 10;
+	if (!melee)
+	{
+		INT32 const impact = GunImpact(attacker, target, accuracy);
+		if (index == -1)
+		{ // tack damage on to end of last hit
+			target.usHitDamage[2] += (UINT16)impact;
+		}
+		else
+		{
+			target.usHitDamage[index] = (UINT16)impact;
+		}
+		return;
+	}
+
+	if (target.bLife == 0) return;
+	INT32 const fluke  = Rnd(51) - 25;
+	INT32 const impact = attacker.ubMeleeImpact * (100 + fluke + accuracy / 2) / 100;
+	target.bLife = (INT8)std::max(target.bLife - impact, 0);
+}
+
+
+void BattleSimulation::TargetHit(SimCombatant& target, INT32 const index)
+{
+	if (target.bLife == 0) return;
+	UINT16 const divisor = target.ubDamageDivisor;
+	INT32  const damage  = (target.usHitDamage[index] + divisor / 2) / divisor;
+	target.bLife = (INT8)std::max(target.bLife - damage, 0);
+}
+
+
+void BattleSimulation::Fight()
+{
+	for (UINT32 elapsed = 0; elapsed < MAX_PREDICTION_BATTLE_TIME; elapsed += 1000)
+	{
+		// Everybody gets one turn per second of battle time in random order
+		std::shuffle(m_order.begin(), m_order.end(), m_engine);
+		for (size_t const idx : m_order)
+		{
+			if (IsBattleOver()) return;
+
+			SimCombatant& c = m_cells[idx];
+			for (INT32 i = 0; i != 3; ++i)
+			{ // Check if any incoming bullets have hit the target.
+				if (!c.usNextHit[i]) continue;
+				INT32 const time = c.usNextHit[i] - 1000;
+				if (time >= 0)
+				{
+					c.usNextHit[i] = (UINT16)time;
+				}
+				else
+				{
+					TargetHit(c, i);
+					c.usNextHit[i] = 0;
+				}
+			}
+
+			if (c.bLife < OKLIFE && (!c.fCreature || c.bLife == 0)) continue;
+
+			INT32 const time = c.usNextAttack - 1000;
+			if (time > 0)
+			{
+				c.usNextAttack = (UINT16)time;
+				continue;
+			}
+			if (!c.usAttack) continue;
+
+			SimCombatant* const target = ChooseTarget(c);
+			if (target && !(c.fCreature && Rnd(100) < 7)) AttackTarget(c, *target);
+			ResetNextAttackCounter(c);
+			c.usNextAttack += (UINT16)time; // tack on the remainder
+		}
+	}
+	m_outcome.fPlayerWon = false;
+}
+
+
+SimOutcome BattleSimulation::Run()
+{
+	Fight();
+	for (SimCombatant const& c : m_cells)
+	{
+		if (c.bLife != 0) continue;
+		++(c.fPlayerSide ? m_outcome.uiPlayerCasualties : m_outcome.uiEnemyCasualties);
+	}
+	return m_outcome;
+}
+
+
+AutoResolvePrediction PredictAutoResolve(std::vector<AutoResolveCombatant> const& combatants, UINT32 const uiSimulations)
+{
+	// Draw all seeds up front, so the result only depends on gRandomEngine
+	std::vector<UINT32> seeds(uiSimulations);
+	for (UINT32& seed : seeds) seed = gRandomEngine();
+
+	std::vector<SimOutcome> outcomes(uiSimulations);
+	std::atomic<UINT32> next(0);
+	auto worker = [&]()
+	{
+		for (;;)
+		{
+			UINT32 const i = next++;
+			if (i >= uiSimulations) break;
+			outcomes[i] = BattleSimulation(combatants, seeds[i]).Run();
+		}
+	};
+
+	size_t const n_threads = std::max(1U, std::min(std::thread::hardware_concurrency(), uiSimulations));
+	std::vector<std::thread> threads;
+	for (size_t i = 1; i < n_threads; ++i) threads.emplace_back(worker);
+	worker();
+	for (std::thread& t : threads) t.join();
+
+	AutoResolvePrediction p{};
+	p.uiSimulations = uiSimulations;
+	if (!uiSimulations) return p;
+
+	UINT32 wins = 0;
+	uint64_t player_casualties = 0, enemy_casualties = 0, player_rounds = 0, enemy_rounds = 0;
+	for (SimOutcome const& o : outcomes)
+	{
+		if (o.fPlayerWon) ++wins;
+		player_casualties += o.uiPlayerCasualties;
+		enemy_casualties  += o.uiEnemyCasualties;
+		player_rounds     += o.uiPlayerRoundsFired;
+		enemy_rounds      += o.uiEnemyRoundsFired;
+	}
+	double const n = uiSimulations;
+	p.dPlayerWinChance   = wins              / n;
+	p.dPlayerCasualties  = player_casualties / n;
+	p.dEnemyCasualties   = enemy_casualties  / n;
+	p.dPlayerRoundsFired = player_rounds     / n;
+	p.dEnemyRoundsFired  = enemy_rounds      / n;
+	return p;
+}
@@ -0,0 +1,51 @@
+#ifndef AUTO_RESOLVE_PREDICTION_H
+#define AUTO_RESOLVE_PREDICTION_H
+
+#include "JA2Types.h"
+
+#include <vector>
+
+// Headless copy of the auto resolve combat math.  A battle is described by a
+// plain snapshot of its combatants, which is then fought out many times over
+// without touching the soldiers, the profiles or the sound system.  Every
+// simulation draws from its own random number stream, which is seeded from
+// gRandomEngine up front, so the outcome does not depend on how the
+// simulations are spread over the worker threads.
+
+struct AutoResolveCombatant
+{
+	bool   fPlayerSide;
+	bool   fEPC;            // does not fight, the player loses when only EPCs are left
+	bool   fCreature;       // attacks faster and ignores the melee penalty
+	bool   fClaws;          // female creatures only ever attack in melee
+	bool   fSpit;           // male creatures have an unlimited ranged attack
+	bool   fBlade;          // melee attacks are done with a blade
+	UINT16 usAttack;
+	UINT16 usDefence;
+	UINT16 usNextAttack;    // time until the first attack in milliseconds
+	INT8   bLife;
+	UINT16 usRounds;        // loaded rounds plus the spare ammo for the gun in hand
+	UINT8  ubGunImpact;     // 0 if the combatant has no gun
+	UINT8  ubMeleeImpact;   // HTHImpact() before the random factors
+	UINT8  ubArmourPercent;
+	UINT8  ubDamageDivisor; // damage reduction of creatures, 1 for everybody else
+};
+
+struct AutoResolvePrediction
+{
+	UINT32 uiSimulations;
+	double dPlayerWinChance;   // share of the simulations the enemies were wiped out
+	double dPlayerCasualties;  // expected number of killed mercs and militia
+	double dEnemyCasualties;   // expected number of killed enemies and creatures
+	double dPlayerRoundsFired; // expected ammo use of the player side
+	double dEnemyRoundsFired;  // expected ammo use of the enemy side
+};
+
+// Fills in the equipment part of a combatant (gun, ammo, melee, armour and the
+// creature specifics).  Side, attack, defence and timing are up to the caller.
+void AutoResolveCombatantFromSoldier(AutoResolveCombatant&, SOLDIERTYPE const&);
+
+// Fights the battle uiSimulations times spread over all cores.
+AutoResolvePrediction PredictAutoResolve(std::vector<AutoResolveCombatant> const&, UINT32 uiSimulations);
+
+#endif
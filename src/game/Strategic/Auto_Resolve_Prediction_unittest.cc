@@ -0,0 +1,49 @@
+#include "gtest/gtest.h"
+
+#include "Auto_Resolve_Prediction.h"
+#include "Random.h"
+
+
+static AutoResolveCombatant MakeCombatant(bool const fPlayerSide, UINT16 const usAttack, UINT8 const ubGunImpact)
+{
+	AutoResolveCombatant c{};
+	c.fPlayerSide     = fPlayerSide;
+	c.usAttack        = usAttack;
+	c.usDefence       = 50;
+	c.usNextAttack    = 1000;
+	c.bLife           = 60;
+	c.usRounds        = 30;
+	c.ubGunImpact     = ubGunImpact;
+	c.ubMeleeImpact   = 10;
+	c.ubArmourPercent = 20;
+	c.ubDamageDivisor = 1;
+	return c;
+}
+
+
+TEST(AutoResolvePrediction, sameSeedSameOutcome)
+{
+	std::vector<AutoResolveCombatant> const combatants
+	{
+		MakeCombatant(true,  80, 25),
+		MakeCombatant(true,  70, 22),
+		MakeCombatant(false, 60, 20),
+		MakeCombatant(false, 55, 20),
+		MakeCombatant(false, 50, 18)
+	};
+
+	SeedRandom(1234);
+	AutoResolvePrediction const a = PredictAutoResolve(combatants, 200);
+	SeedRandom(1234);
+	AutoResolvePrediction const b = PredictAutoResolve(combatants, 200);
+
+	EXPECT_EQ(a.uiSimulations, 200u);
+	EXPECT_EQ(a.uiSimulations,      b.uiSimulations);
+	EXPECT_EQ(a.dPlayerWinChance,   b.dPlayerWinChance);
+	EXPECT_EQ(a.dPlayerCasualties,  b.dPlayerCasualties);
+	EXPECT_EQ(a.dEnemyCasualties,   b.dEnemyCasualties);
+	EXPECT_EQ(a.dPlayerRoundsFired, b.dPlayerRoundsFired);
+	EXPECT_EQ(a.dEnemyRoundsFired,  b.dEnemyRoundsFired);
+	// the battle was actually fought
+	EXPECT_GT(a.dPlayerRoundsFired + a.dEnemyRoundsFired, 0);
+}
@@ -14,6 +14,7 @@
 #include "HImage.h"
 #include "Interface.h"
 #include "Line.h"
+#include "Local.h"
 #include "Map_Information.h"
 #include "Map_Screen_Helicopter.h"
 #include "Map_Screen_Interface.h"
@@ -239,6 +240,11 @@ enum{
 // the big map .pcx
 static SGPVSurface* guiBIGMAP;
 
+// guiBIGMAP at half size with the sectors shaded, it is only rebuilt when the
+// shading changes.  The key holds the state it was built from.
+static SGPVSurface*        guiMapTerrainLayer;
+static std::vector<UINT8> gMapTerrainLayerKey;
+
 // boxes for characters on the map
 static SGPVObject* guiCHARICONS;
 
@@ -482,7 +488,7 @@ static void DrawBullseye(void);
 static void DrawSecretSite(const StrategicMapSecretModel*);
 static void DrawTownMilitiaForcesOnMap();
 static void HandleLowerLevelMapBlit(void);
-static void ShadeMapElem(const SGPSector& sMap, INT32 iColor);
+static void UpdateMapTerrainLayer(void);
 static void ShowItemsOnMap(void);
 static void ShowSAMSitesOnStrategicMap();
 static void ShowTeamAndVehicles();
@@ -493,57 +499,9 @@ void DrawMap(void)
 {
 	if (!iCurrentMapSectorZ)
 	{
-		BltVideoSurfaceHalf(guiSAVEBUFFER, guiBIGMAP, MAP_VIEW_START_X + 1, MAP_VIEW_START_Y, NULL);
-
-		// shade map sectors (must be done after Tixa/Orta/Mine icons have been blitted, but before icons!)
-		SGPSector sSector(1, 1, iCurrentMapSectorZ);
-		for (sSector.x = 1; sSector.x < MAP_WORLD_X - 1; ++sSector.x)
-		{
-			for (sSector.y = 1; sSector.y < MAP_WORLD_Y - 1; ++sSector.y)
-			{
-				if (!GetSectorFlagStatus(sSector, SF_ALREADY_VISITED))
-				{
-					INT32 color;
-					if (fShowAircraftFlag)
-					{
-						if (!StrategicMap[sSector.AsStrategicIndex()].fEnemyAirControlled)
-						{
-							// sector not visited, not air controlled
-							color = MAP_SHADE_DK_GREEN;
-						}
-						else
-						{
-							// sector not visited, controlled and air not
-							color = MAP_SHADE_DK_RED;
-						}
-					}
-					else
-					{
-						// not visited
-						color = MAP_SHADE_BLACK;
-					}
-					ShadeMapElem(sSector, color);
-				}
-				else
-				{
-					if (fShowAircraftFlag)
-					{
-						INT32 color;
-						if (!StrategicMap[sSector.AsStrategicIndex()].fEnemyAirControlled)
-						{
-							// sector visited and air controlled
-							color = MAP_SHADE_LT_GREEN;
-						}
-						else
-						{
-							// sector visited but not air controlled
-							color = MAP_SHADE_LT_RED;
-						}
-						ShadeMapElem(sSector, color);
-					}
-				}
-			}
-		}
+		// the map with the sectors shaded
+		UpdateMapTerrainLayer();
+		BltVideoSurface(guiSAVEBUFFER, guiMapTerrainLayer, MAP_VIEW_START_X + 1, MAP_VIEW_START_Y, NULL);
 
 		/* unfortunately, we can't shade these icons as part of shading the map,
 		 * because for airspace, the shade function doesn't merely shade the
@@ -784,26 +742,27 @@ static void ShadeMapElem(const SGPSector& sMap, const INT32 iColor)
 	INT16 sScreenY;
 	GetScreenXYFromMapXY(sMap, &sScreenX, &sScreenY);
 
-	// compensate for original BIG_MAP blit being done at MAP_VIEW_START_X + 1
-	sScreenX += 1;
+	// the terrain layer is blitted to MAP_VIEW_START_X + 1, MAP_VIEW_START_Y
+	INT16 const x = sScreenX - MAP_VIEW_START_X;
+	INT16       y = sScreenY - MAP_VIEW_START_Y;
 
 	SGPBox const clip =
 	{
-		(UINT16)(2 * (sScreenX - (MAP_VIEW_START_X + 1))),
-		(UINT16)(2 * (sScreenY - MAP_VIEW_START_Y)),
+		(UINT16)(2 * x),
+		(UINT16)(2 * y),
 		2 * MAP_GRID_X,
 		2 * MAP_GRID_Y
 	};
 
 	// non-airspace
-	if (iColor == MAP_SHADE_BLACK) sScreenY -= 1;
+	if (iColor == MAP_SHADE_BLACK) y -= 1;
 
 	UINT16* pal;
 	switch (iColor)
 	{
 	case MAP_SHADE_BLACK:
 		// simply shade darker
-		guiSAVEBUFFER->ShadowRect(sScreenX, sScreenY, sScreenX + MAP_GRID_X - 1, sScreenY + MAP_GRID_Y - 1);
+		guiMapTerrainLayer->ShadowRect(x, y, x + MAP_GRID_X - 1, y + MAP_GRID_Y - 1);
 		return;
 
 	case MAP_SHADE_LT_GREEN: pal = pMapLTGreenPalette; break;
@@ -819,11 +778,60 @@ static void ShadeMapElem(const SGPSector& sMap, const INT32 iColor)
 
 	UINT16* const org_pal = map->p16BPPPalette;
 	map->p16BPPPalette = pal;
-	BltVideoSurfaceHalf(guiSAVEBUFFER, guiBIGMAP, sScreenX, sScreenY, &clip);
+	BltVideoSurfaceHalf(guiMapTerrainLayer, guiBIGMAP, x, y, &clip);
 	map->p16BPPPalette = org_pal;
 }
 
 
+// the shade of a sector on the surface map, -1 if it is not shaded
+static INT32 GetMapElemShade(const SGPSector& sSector)
+{
+	bool const air_controlled = !StrategicMap[sSector.AsStrategicIndex()].fEnemyAirControlled;
+	if (!GetSectorFlagStatus(sSector, SF_ALREADY_VISITED))
+	{
+		if (!fShowAircraftFlag) return MAP_SHADE_BLACK; // not visited
+		// sector not visited, (not) air controlled
+		return air_controlled ? MAP_SHADE_DK_GREEN : MAP_SHADE_DK_RED;
+	}
+	else
+	{
+		if (!fShowAircraftFlag) return -1;
+		// sector visited, (not) air controlled
+		return air_controlled ? MAP_SHADE_LT_GREEN : MAP_SHADE_LT_RED;
+	}
+}
+
+
+static void UpdateMapTerrainLayer(void)
+{
+	std::vector<UINT8> key;
+	key.reserve(MAP_WORLD_X * MAP_WORLD_Y);
+	SGPSector sSector(1, 1, 0);
+	for (sSector.x = 1; sSector.x < MAP_WORLD_X - 1; ++sSector.x)
+	{
+		for (sSector.y = 1; sSector.y < MAP_WORLD_Y - 1; ++sSector.y)
+		{
+			key.push_back(UINT8(GetMapElemShade(sSector)));
+		}
+	}
+	if (key == gMapTerrainLayerKey) return;
+	gMapTerrainLayerKey = std::move(key);
+
+	BltVideoSurfaceHalf(guiMapTerrainLayer, guiBIGMAP, 0, 0, NULL);
+
+	// shade map sectors (must be done after Tixa/Orta/Mine icons have been blitted, but before icons!)
+	size_t i = 0;
+	for (sSector.x = 1; sSector.x < MAP_WORLD_X - 1; ++sSector.x)
+	{
+		for (sSector.y = 1; sSector.y < MAP_WORLD_Y - 1; ++sSector.y)
+		{
+			INT32 const color = INT8(gMapTerrainLayerKey[i++]);
+			if (color != -1) ShadeMapElem(sSector, color);
+		}
+	}
+}
+
+
 static void InitializePalettesForMap(SGPPaletteEntry const * const pal)
 {
 	if (pMapDKGreenPalette) return;
@@ -2694,6 +2702,7 @@ static void DropAPersonInASector(UINT8 const type, UINT8 const sector)
 void LoadMapScreenInterfaceMapGraphics()
 {
 	guiBIGMAP                      = AddVideoSurfaceFromFile(INTERFACEDIR "/b_map.pcx");
+	guiMapTerrainLayer             = AddVideoSurface(guiBIGMAP->Width() / 2, guiBIGMAP->Height() / 2, PIXEL_DEPTH);
 	guiBULLSEYE                    = AddVideoObjectFromFile(INTERFACEDIR "/bullseye.sti");
 	guiSAMICON                     = AddVideoObjectFromFile(INTERFACEDIR "/sam.sti");
 	guiCHARBETWEENSECTORICONS      = AddVideoObjectFromFile(INTERFACEDIR "/merc_between_sector_icons.sti");
@@ -2727,6 +2736,8 @@ void LoadMapScreenInterfaceMapGraphics()
 void DeleteMapScreenInterfaceMapGraphics()
 {
 	DeleteVideoSurface(guiBIGMAP);
+	DeleteVideoSurface(guiMapTerrainLayer);
+	gMapTerrainLayerKey.clear();
 	DeleteVideoObject(guiBULLSEYE);
 	DeleteVideoObject(guiSAMICON);
 	DeleteVideoObject(guiCHARBETWEENSECTORICONS);
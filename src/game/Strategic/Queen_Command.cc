@@ -1153,6 +1153,7 @@ static void CaptureSoldier(SOLDIERTYPE* const s, const SGPSector& sMap, GridNo c
 {
 	s->sSector                  = sMap;
 	s->bLevel                   = 0; // put him on the floor
+	UpdateSoldierHotState(*s);
 	s->ubStrategicInsertionCode = INSERTION_CODE_GRIDNO;
 	s->usStrategicInsertionData = soldier_pos;
 
@@ -1234,6 +1235,7 @@ void EnemyCapturesPlayerSoldier( SOLDIERTYPE *pSoldier )
 	if ( gubQuest[ QUEST_HELD_IN_ALMA ] == QUESTNOTSTARTED )
 	{
 		pSoldier->bNeutral = TRUE;
+		UpdateSoldierHotState(*pSoldier);
 	}
 
 	RemoveCharacterFromSquads( pSoldier );
@@ -6,6 +6,7 @@
 #include "SamSiteModel.h"
 #include "SaveLoadMap.h"
 #include "StrategicMap.h"
+#include "Strategic_Pathing.h"
 #include "TileDat.h"
 #include "TileDef.h"
 #include "WorldMan.h"
@@ -88,6 +89,7 @@ void UpdateAirspaceControl()
 			StrategicMap[sMap.AsStrategicIndex()].fEnemyAirControlled = fEnemyControlsAir;
 		}
 	}
+	InvalidateStrategicPathCache();
 
 	OnAirspaceControlUpdated();
 }
@@ -616,6 +616,7 @@ static void AutoProcessSchedule(SCHEDULENODE* pSchedule, INT32 index)
 				pSoldier->sOffWorldGridNo = pSchedule->usData2[ index ];
 				MoveSoldierFromMercToAwaySlot( pSoldier );
 				pSoldier->bInSector = FALSE;
+				UpdateSoldierHotState(*pSoldier);
 			}
 			else
 			{
@@ -639,6 +640,7 @@ static void AutoProcessSchedule(SCHEDULENODE* pSchedule, INT32 index)
 			EVENT_SetSoldierPositionNoCenter(pSoldier, pSchedule->usData1[index], SSP_FORCE_DELETE);
 			MoveSoldierFromAwayToMercSlot( pSoldier );
 			pSoldier->bInSector = TRUE;
+			UpdateSoldierHotState(*pSoldier);
 			// let this person patrol from here from now on
 			pSoldier->usPatrolGrid[0] = pSchedule->usData1[ index ];
 			break;
@@ -673,6 +675,7 @@ static void AutoProcessSchedule(SCHEDULENODE* pSchedule, INT32 index)
 			pSoldier->sOffWorldGridNo = sGridNo;
 			MoveSoldierFromMercToAwaySlot( pSoldier );
 			pSoldier->bInSector = FALSE;
+			UpdateSoldierHotState(*pSoldier);
 			break;
 		}
 	}
@@ -969,7 +972,7 @@ static void PerformActionOnDoorAdjacentToGridNo(UINT8 ubScheduleAction, UINT16 u
 				pDoor = FindDoorInfoAtGridNo( sDoorGridNo );
 				if (pDoor)
 				{
-					pDoor->fLocked = TRUE;
+					pDoor->setLocked(true);
 				}
 				// make sure it's closed as well
 				ModifyDoorStatus( sDoorGridNo, FALSE, DONTSETDOORSTATUS );
@@ -978,7 +981,7 @@ static void PerformActionOnDoorAdjacentToGridNo(UINT8 ubScheduleAction, UINT16 u
 				pDoor = FindDoorInfoAtGridNo( sDoorGridNo );
 				if (pDoor)
 				{
-					pDoor->fLocked = FALSE;
+					pDoor->setLocked(false);
 				}
 				break;
 			case SCHEDULE_ACTION_OPENDOOR:
@@ -940,6 +940,7 @@ void UpdateMercsInSector()
 		RemoveMercSlot(&s);
 
 		s.bInSector = FALSE;
+		UpdateSoldierHotState(s);
 
 		if (!s.bActive)             continue;
 		if (s.sSector != gWorldSector) continue;
@@ -983,6 +984,7 @@ void UpdateMercsInSector()
 				AddCharacterToUniqueSquad(&s);
 				pow_squad  = s.bAssignment;
 				s.bNeutral = FALSE;
+				UpdateSoldierHotState(s);
 			}
 		}
 		else
@@ -2357,6 +2359,7 @@ void LoadStrategicInfoFromSavedFile(HWFILE const f)
 	{
 		ExtractSectorInfoFromFile(f, *i);
 	}
+	InvalidateStrategicPathCache();
 
 	// Skip the SAM controlled sector information
 	f->seek(MAP_WORLD_X * MAP_WORLD_Y, FILE_SEEK_FROM_CURRENT);
@@ -529,9 +529,10 @@ void CheckForKingpinsMoneyMissing( BOOLEAN fFirstCheck )
 		// the sector is unloaded NOW so set Kingpin's balance and remove the cash
 		gMercProfiles[ KINGPIN ].iBalance = - (30000 - (INT32) uiTotalCash);
 		// remove all money from map
-		FOR_EACH_WORLD_ITEM(wi)
+		for (size_t i = 0; i != gWorldItems.size(); ++i)
 		{
-			if (wi.o.usItem == MONEY) wi.fExists = FALSE; // remove!
+			WORLDITEM const& wi = gWorldItems[i];
+			if (wi.fExists && wi.o.usItem == MONEY) RemoveItemFromWorld(static_cast<INT32>(i)); // remove!
 		}
 	}
 	else if ( fKingpinDiscovers )
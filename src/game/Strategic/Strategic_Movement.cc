@@ -2065,6 +2065,27 @@ INT32 FindTravelTimeBetweenWaypoints(WAYPOINT const* const pSource, WAYPOINT con
 
 
 // Changes: direction contains the strategic move value, not the delta value.
+INT32 GetGroupFootEncumbrance(GROUP const& g)
+{
+	INT32 highest_encumbrance = 100;
+	if (!g.fPlayer || !(g.ubTransportationMask & FOOT)) return highest_encumbrance;
+
+	CFOR_EACH_PLAYER_IN_GROUP(curr, &g)
+	{
+		SOLDIERTYPE const* const s = curr->pSoldier;
+		if (s->bAssignment == VEHICLE) continue;
+		/* Soldier is on foot and travelling.  Factor encumbrance into movement
+		 * rate. */
+		INT32 const encumbrance = CalculateCarriedWeight(s);
+		if (highest_encumbrance < encumbrance)
+		{
+			highest_encumbrance = encumbrance;
+		}
+	}
+	return highest_encumbrance;
+}
+
+
 INT32 GetSectorMvtTimeForGroup(UINT8 const ubSector, UINT8 const direction, GROUP const* const g)
 {
 	/* Determine the group's method(s) of transportation.  If more than one, we
@@ -2106,23 +2127,7 @@ INT32 GetSectorMvtTimeForGroup(UINT8 const ubSector, UINT8 const direction, GROU
 		if (best_traverse_time > traverse_time)
 			best_traverse_time = traverse_time;
 
-		if (g->fPlayer)
-		{
-			INT32 highest_encumbrance = 100;
-			CFOR_EACH_PLAYER_IN_GROUP(curr, g)
-			{
-				SOLDIERTYPE const* const s = curr->pSoldier;
-				if (s->bAssignment == VEHICLE) continue;
-				/* Soldier is on foot and travelling.  Factor encumbrance into movement
-				 * rate. */
-				INT32 const encumbrance = CalculateCarriedWeight(s);
-				if (highest_encumbrance < encumbrance)
-				{
-					highest_encumbrance = encumbrance;
-				}
-			}
-			best_traverse_time = best_traverse_time * highest_encumbrance / 100;
-		}
+		best_traverse_time = best_traverse_time * GetGroupFootEncumbrance(*g) / 100;
 	}
 
 	if (transport_mask & CAR)
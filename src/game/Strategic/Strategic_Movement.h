@@ -209,6 +209,9 @@ static UINT32 const TRAVERSE_TIME_IMPOSSIBLE = 0xFFFFFFFF;
 // Get travel time for this group
 INT32 GetSectorMvtTimeForGroup(UINT8 ubSector, UINT8 ubDirection, GROUP const*);
 
+// Percentage the travel time on foot is scaled with because of the weight the group carries
+INT32 GetGroupFootEncumbrance(GROUP const&);
+
 UINT8 PlayerMercsInSector(const SGPSector& sector);
 UINT8 PlayerGroupsInSector(const SGPSector& sector);
 
@@ -1,6 +1,7 @@
 #include "Campaign_Types.h"
 #include "Strategic_Movement.h"
 #include "Strategic_Movement_Costs.h"
+#include "Strategic_Pathing.h"
 #include "GameInstance.h"
 #include "ContentManager.h"
 #include "MovementCostsModel.h"
@@ -27,6 +28,7 @@ void InitStrategicMovementCosts()
 			s.ubTraversability[THROUGH_STRATEGIC_MOVE] = movementCosts->getTraversibilityThrough(sMap);
 		}
 	}
+	InvalidateStrategicPathCache();
 }
 
 
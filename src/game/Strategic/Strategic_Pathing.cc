@@ -18,6 +18,8 @@
 
 #include <algorithm>
 #include <iterator>
+#include <unordered_map>
+#include <vector>
 
 static UINT16  gusMapPathingData[256];
 static BOOLEAN gfPlotToAvoidPlayerInfuencedSectors = FALSE;
@@ -185,37 +187,13 @@ static INT16 const diStratDelta[]=
 
 // this will find if a shortest strategic path
 
-INT32 FindStratPath(INT16 const sStart, INT16 const sDestination, GROUP const& g, BOOLEAN const fTacticalTraversal)
+static INT32 SearchStratPath(INT16 const sStart, INT16 const sDestination, GROUP const& g, BOOLEAN const fTacticalTraversal, BOOLEAN const fPlotDirectPath)
 {
 	INT32 iCnt,ndx,insertNdx,qNewNdx;
 	INT32 iDestX,iDestY,locX,locY,dx,dy;
 	UINT16	newLoc,curLoc;
 	TRAILCELLTYPE curCost,newTotCost,nextCost;
 	INT16 sOrigination;
-	BOOLEAN fPlotDirectPath = FALSE;
-	static BOOLEAN fPreviousPlotDirectPath = FALSE;		// don't save
-
-	// ******** Fudge by Bret (for now), curAPcost is never initialized in this function, but should be!
-	// so this is just to keep things happy!
-
-	// for player groups only!
-	if (g.fPlayer)
-	{
-		// if player is holding down SHIFT key, find the shortest route instead of the quickest route!
-		if ( _KeyDown( SHIFT ) )
-		{
-			fPlotDirectPath = TRUE;
-		}
-
-
-		if ( fPlotDirectPath != fPreviousPlotDirectPath )
-		{
-			// must redraw map to erase the previous path...
-			fMapPanelDirty = TRUE;
-			fPreviousPlotDirectPath = fPlotDirectPath;
-		}
-	}
-
 
 	queRequests = 2;
 
@@ -441,6 +419,76 @@ INT32 FindStratPath(INT16 const sStart, INT16 const sDestination, GROUP const& g
 }
 
 
+// Routes found by SearchStratPath, by everything that goes into the search
+// except the sector information, which invalidates all of them.  Routes that
+// avoid player influenced sectors depend on where mercs and militia are and
+// are not remembered.
+static std::unordered_map<uint64_t, std::vector<UINT16>> gStratPathCache;
+
+#define MAX_STRAT_PATH_CACHE_SIZE 4096
+
+
+void InvalidateStrategicPathCache()
+{
+	gStratPathCache.clear();
+}
+
+
+INT32 FindStratPath(INT16 const sStart, INT16 const sDestination, GROUP const& g, BOOLEAN const fTacticalTraversal)
+{
+	BOOLEAN fPlotDirectPath = FALSE;
+	static BOOLEAN fPreviousPlotDirectPath = FALSE;		// don't save
+
+	// for player groups only!
+	if (g.fPlayer)
+	{
+		// if player is holding down SHIFT key, find the shortest route instead of the quickest route!
+		if ( _KeyDown( SHIFT ) )
+		{
+			fPlotDirectPath = TRUE;
+		}
+
+
+		if ( fPlotDirectPath != fPreviousPlotDirectPath )
+		{
+			// must redraw map to erase the previous path...
+			fMapPanelDirty = TRUE;
+			fPreviousPlotDirectPath = fPlotDirectPath;
+		}
+	}
+
+	if (gfPlotToAvoidPlayerInfuencedSectors)
+	{
+		return SearchStratPath(sStart, sDestination, g, fTacticalTraversal, fPlotDirectPath);
+	}
+
+	bool const heli = iHelicopterVehicleId != -1 && GetGroup(GetHelicopter().ubMovementGroup) == &g;
+	uint64_t const key =
+		(uint64_t)(UINT16)sStart                   |
+		(uint64_t)(UINT16)sDestination       << 16 |
+		(uint64_t)g.ubTransportationMask     << 32 |
+		(uint64_t)(heli               ? 1 : 0) << 40 |
+		(uint64_t)(fTacticalTraversal ? 1 : 0) << 41 |
+		(uint64_t)(fPlotDirectPath    ? 1 : 0) << 42 |
+		(uint64_t)(UINT16)GetGroupFootEncumbrance(g) << 48;
+
+	auto const i = gStratPathCache.find(key);
+	if (i != gStratPathCache.end())
+	{
+		std::vector<UINT16> const& route = i->second;
+		std::fill(std::begin(gusMapPathingData), std::end(gusMapPathingData), ((UINT16)sStart));
+		std::copy(route.begin(), route.end(), std::begin(gusMapPathingData));
+		return static_cast<INT32>(route.size());
+	}
+
+	INT32 const length = SearchStratPath(sStart, sDestination, g, fTacticalTraversal, fPlotDirectPath);
+
+	if (gStratPathCache.size() >= MAX_STRAT_PATH_CACHE_SIZE) gStratPathCache.clear();
+	gStratPathCache.emplace(key, std::vector<UINT16>(gusMapPathingData, gusMapPathingData + length));
+	return length;
+}
+
+
 PathSt* BuildAStrategicPath(INT16 const start_sector, INT16 const end_sector, GROUP const& g, BOOLEAN const fTacticalTraversal)
 {
 	if (end_sector < MAP_WORLD_X - 1) return NULL;
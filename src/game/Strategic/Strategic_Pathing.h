@@ -15,6 +15,10 @@
 
 INT32 FindStratPath(INT16 sStart, INT16 sDestination, GROUP const&, BOOLEAN fTacticalTraversal);
 
+// Forget the routes FindStratPath remembers, needed whenever the traversability
+// of a sector or the airspace control changes
+void InvalidateStrategicPathCache();
+
 // build a stategic path
 PathSt* BuildAStrategicPath(INT16 iStartSectorNum, INT16 iEndSectorNum, GROUP const&, BOOLEAN fTacticalTraversal);
 
@@ -6,6 +6,9 @@
 constexpr int ANIM_CACHE_SIZE = 3;
 constexpr UINT16 EMPTY_CACHE_ENTRY = 65000;
 
+// The surfaces a soldier currently holds on to.  Bumping a surface out of
+// these slots only releases it, it stays loaded within the global budget of
+// the surface database until it is needed again.
 class AnimationSurfaceCacheType
 {
 	// Ensure cache state is valid even if init is never called
@@ -9,7 +9,9 @@
 #include "Rotting_Corpses.h"
 #include "ContentManager.h"
 #include "GameInstance.h"
+#include "Isometric_Utils.h"
 #include "Logger.h"
+#include "VObject.h"
 
 // Defines for Anim inst reading, taken from orig Jagged
 #define ANIMFILENAME						BINARYDATADIR "/ja2bin.dat"
@@ -2535,6 +2537,60 @@ char const* GetBodyTypePaletteSubstitution(SOLDIERTYPE const* const s, UINT8 con
 
 
 
+#define MAX_LIKELY_NEXT_ANIM_STATES 6
+
+// The states a soldier is likely to enter next from his current stance, the
+// most likely first.  Returns their number.
+static size_t GetLikelyNextAnimStates(SOLDIERTYPE const& s, UINT16 const usAnimState, UINT16 (&states)[MAX_LIKELY_NEXT_ANIM_STATES])
+{
+	if (!IS_MERC_BODY_TYPE(&s)) return 0;
+
+	static UINT16 const stand[]  = { WALKING, RUNNING, KNEEL_DOWN, CROUCHING };
+	static UINT16 const crouch[] = { SWATTING, KNEEL_UP, PRONE_DOWN, PRONE };
+	static UINT16 const prone[]  = { CRAWLING, PRONE_UP, CROUCHING };
+	static UINT16 const stand_fire[]  = { READY_RIFLE_STAND,  SHOOT_RIFLE_STAND  };
+	static UINT16 const crouch_fire[] = { READY_RIFLE_CROUCH, SHOOT_RIFLE_CROUCH };
+	static UINT16 const prone_fire[]  = { READY_RIFLE_PRONE,  SHOOT_RIFLE_PRONE  };
+
+	UINT16 const* move;
+	UINT16 const* fire;
+	size_t        n_move;
+	switch (gAnimControl[usAnimState].ubEndHeight)
+	{
+		case ANIM_STAND:  move = stand;  n_move = lengthof(stand);  fire = stand_fire;  break;
+		case ANIM_CROUCH: move = crouch; n_move = lengthof(crouch); fire = crouch_fire; break;
+		case ANIM_PRONE:  move = prone;  n_move = lengthof(prone);  fire = prone_fire;  break;
+		default: return 0;
+	}
+
+	size_t n = 0;
+	// Firing is only likely with a gun in hand
+	const ItemModel* const item = GCM->getItem(s.inv[HANDPOS].usItem);
+	if (item->isGun() || item->isLauncher())
+	{
+		states[n++] = fire[0];
+		states[n++] = fire[1];
+	}
+	for (size_t i = 0; i != n_move; ++i) states[n++] = move[i];
+	return n;
+}
+
+
+// Start loading the surfaces of the states a soldier is likely to enter next
+// from his current stance, so they are ready when he gets there
+static void PrefetchLikelyAnimationSurfaces(SOLDIERTYPE const& s, UINT16 const usAnimState)
+{
+	UINT16       states[MAX_LIKELY_NEXT_ANIM_STATES];
+	size_t const n = GetLikelyNextAnimStates(s, usAnimState, states);
+	for (size_t i = 0; i != n; ++i)
+	{
+		UINT16 const surface = DetermineSoldierAnimationSurface(&s, states[i]);
+		if (surface == INVALID_ANIMATION_SURFACE) continue;
+		PrefetchAnimationSurface(s.ubID, surface, states[i]);
+	}
+}
+
+
 BOOLEAN SetSoldierAnimationSurface( SOLDIERTYPE *pSoldier, UINT16 usAnimState )
 {
 	// Delete any structure info!
@@ -2561,6 +2617,8 @@ BOOLEAN SetSoldierAnimationSurface( SOLDIERTYPE *pSoldier, UINT16 usAnimState )
 		return( FALSE );
 	}
 
+	PrefetchLikelyAnimationSurfaces(*pSoldier, usAnimState);
+
 	return( TRUE );
 }
 
@@ -2829,8 +2887,9 @@ UINT16 GetSoldierAnimationSurface(SOLDIERTYPE const* const pSoldier)
 
 	if ( usAnimSurface != INVALID_ANIMATION_SURFACE )
 	{
-		// Ensure that it's loaded!
-		if ( gAnimSurfaceDatabase[usAnimSurface].hVideoObject == NULL )
+		// Ensure that it's loaded or at least on its way!
+		if ( gAnimSurfaceDatabase[usAnimSurface].hVideoObject == NULL &&
+			gAnimSurfaceDatabase[usAnimSurface].bUsageCount == 0 )
 		{
 			SLOGW("Animation Surface for Body {}, animation {}, surface {} not loaded.",
 				pSoldier->ubBodyType, gAnimControl[pSoldier->usAnimState].zAnimStr, usAnimSurface);
@@ -2842,12 +2901,69 @@ UINT16 GetSoldierAnimationSurface(SOLDIERTYPE const* const pSoldier)
 }
 
 
+HVOBJECT GetSoldierAnimationPlaceholder(SOLDIERTYPE const& s, UINT16& usFrame)
+{
+	// Stand in with the first frame of the standing animation in his direction
+	UINT16 const surface = DetermineSoldierAnimationSurface(&s, STANDING);
+	if (surface == INVALID_ANIMATION_SURFACE) return NULL;
+
+	AnimationSurfaceType const& as = gAnimSurfaceDatabase[surface];
+	if (!as.hVideoObject) return NULL;
+
+	usFrame = as.uiNumDirections == 8 ? as.uiNumFramesPerDir * OneCDirection(s.bDirection) : 0;
+	if (usFrame >= as.hVideoObject->SubregionCount()) usFrame = 0;
+	return as.hVideoObject;
+}
+
+
 #ifdef WITH_UNITTESTS
 #include "gtest/gtest.h"
+#include "DefaultContentManager.h"
+#include "DefaultContentManagerUT.h"
+
+#include <memory>
+#include <utility>
 
 TEST(AnimationControl, asserts)
 {
 	EXPECT_EQ(lengthof(gAnimControl), NUMANIMATIONSTATES);
 }
 
+TEST(AnimationControl, likelyNextAnimStates)
+{
+	std::unique_ptr<DefaultContentManager> cm(DefaultContentManagerUT::createDefaultCMForTesting());
+	ASSERT_TRUE(cm->loadGameData());
+	auto const oldGCM = std::exchange(GCM, cm.release());
+
+	SOLDIERTYPE s{};
+	s.ubBodyType = REGMALE;
+	UINT16 states[MAX_LIKELY_NEXT_ANIM_STATES];
+
+	// Unarmed he only moves on
+	ASSERT_EQ(GetLikelyNextAnimStates(s, STANDING, states), 4u);
+	EXPECT_EQ(states[0], WALKING);
+	EXPECT_EQ(states[1], RUNNING);
+	EXPECT_EQ(states[2], KNEEL_DOWN);
+	EXPECT_EQ(states[3], CROUCHING);
+
+	// With a gun firing comes first
+	s.inv[HANDPOS].usItem = GLOCK_17;
+	ASSERT_EQ(GetLikelyNextAnimStates(s, CROUCHING, states), 6u);
+	EXPECT_EQ(states[0], READY_RIFLE_CROUCH);
+	EXPECT_EQ(states[1], SHOOT_RIFLE_CROUCH);
+	EXPECT_EQ(states[2], SWATTING);
+	EXPECT_EQ(states[5], PRONE);
+
+	ASSERT_EQ(GetLikelyNextAnimStates(s, PRONE, states), 5u);
+	EXPECT_EQ(states[0], READY_RIFLE_PRONE);
+	EXPECT_EQ(states[2], CRAWLING);
+
+	// Animals and vehicles are not predicted
+	s.ubBodyType = COW;
+	EXPECT_EQ(GetLikelyNextAnimStates(s, STANDING, states), 0u);
+
+	delete GCM;
+	GCM = oldGCM;
+}
+
 #endif
@@ -548,4 +548,9 @@ UINT16 LoadSoldierAnimationSurface(SOLDIERTYPE&, UINT16 anim_state);
 // Also does some debug checking
 UINT16 GetSoldierAnimationSurface(SOLDIERTYPE const*);
 
+// While the surface of a soldier is still loading in the background, he is
+// drawn with this video object and frame instead.  Returns NULL if there is
+// nothing to stand in either.
+HVOBJECT GetSoldierAnimationPlaceholder(SOLDIERTYPE const&, UINT16& usFrame);
+
 #endif
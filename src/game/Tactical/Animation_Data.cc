@@ -11,10 +11,18 @@
 #include "ContentManager.h"
 #include "GameInstance.h"
 #include "Logger.h"
+#include "SGPFile.h"
+#include "STCI.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <iterator>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #define EMPTY_SLOT					-1
 #define TO_INIT					0
@@ -31,6 +39,53 @@ static UINT8 gubNumAnimProfiles = 0;
 
 INT8 gbAnimUsageHistory[ NUMANIMATIONSURFACETYPES ][ MAX_NUM_SOLDIERS ];
 
+// Surfaces nobody uses anymore stay loaded until all loaded surfaces together
+// exceed this many bytes.  Then the least recently used ones are dropped.
+#define ANIM_SURFACE_BUDGET				(48 * 1024 * 1024)
+
+static UINT32 guiAnimSurfaceBytes = 0;
+static UINT32 guiAnimSurfaceSize[NUMANIMATIONSURFACETYPES];
+static UINT32 guiAnimSurfaceLastUse[NUMANIMATIONSURFACETYPES];
+static UINT32 guiAnimSurfaceUseCounter = 0;
+
+// Background loader for predicted animation surfaces.  The main thread opens
+// the file, the loader thread reads and decodes the image and the main thread
+// turns it into a video object again.
+enum class PrefetchState : UINT8 { None, Queued, Loading, Done };
+
+struct AnimSurfacePrefetch
+{
+	PrefetchState             state;
+	SGPFile*                  file;
+	SGPImage*                 image;
+	STRUCTURE_FILE_REF const* structure;
+};
+
+static AnimSurfacePrefetch     gAnimSurfacePrefetch[NUMANIMATIONSURFACETYPES];
+static std::deque<UINT16>      gAnimSurfacePrefetchQueue;
+static std::mutex              gAnimSurfacePrefetchMutex;
+static std::condition_variable gAnimSurfacePrefetchWork;
+static std::condition_variable gAnimSurfacePrefetchDone;
+static bool                    gfAnimSurfacePrefetchQuit = false;
+
+// Owns the loader thread.  It is joined when the animation system is shut
+// down, or at the latest when the program exits, so a running thread is never
+// destroyed.
+class AnimSurfacePrefetchLoader
+{
+	public:
+		~AnimSurfacePrefetchLoader() { Stop(); }
+
+		bool IsRunning() const { return m_thread.joinable(); }
+		void Start();
+		void Stop();
+
+	private:
+		std::thread m_thread;
+};
+
+static AnimSurfacePrefetchLoader gAnimSurfacePrefetchLoader;
+
 
 #define M(name, file, type, flags, dir, profile)	{ name, file, type, flags, dir, TO_INIT, NULL, 0, profile }
 
@@ -530,6 +585,7 @@ static AnimationStructureType gAnimStructureDatabase[TOTALBODYTYPES][NUM_STRUCT_
 
 
 static void LoadAnimationProfiles(void);
+static void AnimSurfacePrefetchThread();
 
 
 void InitAnimationSystem()
@@ -554,6 +610,8 @@ void InitAnimationSystem()
 			}
 		}
 	}
+
+	gAnimSurfacePrefetchLoader.Start();
 }
 
 
@@ -562,6 +620,15 @@ static void DeleteAnimationProfiles(void);
 
 void DeInitAnimationSystem()
 {
+	gAnimSurfacePrefetchLoader.Stop();
+	gAnimSurfacePrefetchQueue.clear();
+	for (AnimSurfacePrefetch& p : gAnimSurfacePrefetch)
+	{
+		if (p.file)  DeleteSGPFile(p.file);
+		if (p.image) delete p.image;
+		p = AnimSurfacePrefetch{};
+	}
+
 	FOR_EACH(AnimationSurfaceType, i, gAnimSurfaceDatabase)
 	{
 		SGPVObject*& vo = i->hVideoObject;
@@ -569,6 +636,7 @@ void DeInitAnimationSystem()
 		DeleteVideoObject(vo);
 		vo = 0;
 	}
+	guiAnimSurfaceBytes = 0;
 
 	// Delete all animation structures
 	// ATE: Don't delete here, will be deleted when the structure database is destoryed
@@ -630,6 +698,208 @@ STRUCTURE_FILE_REF* GetAnimationStructureRef(const SOLDIERTYPE* const s, const U
 }
 
 
+void AnimSurfacePrefetchLoader::Start()
+{
+	if (m_thread.joinable()) return;
+	gfAnimSurfacePrefetchQuit = false;
+	m_thread = std::thread(AnimSurfacePrefetchThread);
+}
+
+
+void AnimSurfacePrefetchLoader::Stop()
+{
+	if (!m_thread.joinable()) return;
+	{
+		std::lock_guard<std::mutex> lock(gAnimSurfacePrefetchMutex);
+		gfAnimSurfacePrefetchQuit = true;
+	}
+	gAnimSurfacePrefetchWork.notify_one();
+	m_thread.join();
+}
+
+
+static void AnimSurfacePrefetchThread()
+{
+	std::unique_lock<std::mutex> lock(gAnimSurfacePrefetchMutex);
+	for (;;)
+	{
+		gAnimSurfacePrefetchWork.wait(lock, []{ return gfAnimSurfacePrefetchQuit || !gAnimSurfacePrefetchQueue.empty(); });
+		if (gfAnimSurfacePrefetchQuit) return;
+
+		UINT16 const usSurfaceIndex = gAnimSurfacePrefetchQueue.front();
+		gAnimSurfacePrefetchQueue.pop_front();
+		AnimSurfacePrefetch& p = gAnimSurfacePrefetch[usSurfaceIndex];
+		p.state = PrefetchState::Loading;
+		AutoSGPFile f(p.file);
+		p.file = NULL;
+
+		lock.unlock();
+		SGPImage* image = NULL;
+		try
+		{
+			image = LoadSTCIFileToImage(f, IMAGE_ALLDATA);
+		}
+		catch (...)
+		{
+			// The main thread loads the surface again and reports the error
+		}
+		f.Deallocate();
+		lock.lock();
+
+		p.image = image;
+		p.state = PrefetchState::Done;
+		gAnimSurfacePrefetchDone.notify_all();
+	}
+}
+
+
+// Wait for the background loader to finish a surface and take its image.
+// Returns NULL if the surface is not being loaded in the background or the
+// loader failed.
+static SGPImage* TakePrefetchedAnimationSurface(UINT16 const usSurfaceIndex, STRUCTURE_FILE_REF const** const structure)
+{
+	std::unique_lock<std::mutex> lock(gAnimSurfacePrefetchMutex);
+	AnimSurfacePrefetch& p = gAnimSurfacePrefetch[usSurfaceIndex];
+	if (p.state == PrefetchState::None) return NULL;
+
+	if (p.state == PrefetchState::Queued)
+	{
+		// Do not wait for the jobs in front of it, load it right here
+		auto const i = std::find(gAnimSurfacePrefetchQueue.begin(), gAnimSurfacePrefetchQueue.end(), usSurfaceIndex);
+		gAnimSurfacePrefetchQueue.erase(i);
+		AutoSGPFile f(p.file);
+		p = AnimSurfacePrefetch{};
+		lock.unlock();
+		return LoadSTCIFileToImage(f, IMAGE_ALLDATA);
+	}
+
+	gAnimSurfacePrefetchDone.wait(lock, [&p]{ return p.state == PrefetchState::Done; });
+	SGPImage* const image = p.image;
+	*structure = p.structure;
+	p = AnimSurfacePrefetch{};
+	return image;
+}
+
+
+static bool IsAnimationSurfacePending(UINT16 const usSurfaceIndex)
+{
+	std::lock_guard<std::mutex> lock(gAnimSurfacePrefetchMutex);
+	PrefetchState const state = gAnimSurfacePrefetch[usSurfaceIndex].state;
+	return state == PrefetchState::Queued || state == PrefetchState::Loading;
+}
+
+
+static void TouchAnimationSurface(UINT16 const usSurfaceIndex)
+{
+	guiAnimSurfaceLastUse[usSurfaceIndex] = ++guiAnimSurfaceUseCounter;
+}
+
+
+// The least recently used surface nobody uses, if the loaded surfaces exceed
+// the budget.  Returns -1 if they fit or no surface can be dropped.
+static INT32 AnimationSurfaceToUnload()
+{
+	if (guiAnimSurfaceBytes <= ANIM_SURFACE_BUDGET) return -1;
+
+	INT32 victim = -1;
+	for (INT32 i = 0; i < NUMANIMATIONSURFACETYPES; ++i)
+	{
+		AnimationSurfaceType const& a = gAnimSurfaceDatabase[i];
+		if (!a.hVideoObject || a.bUsageCount != 0) continue;
+		if (victim == -1 || guiAnimSurfaceLastUse[i] < guiAnimSurfaceLastUse[victim]) victim = i;
+	}
+	return victim;
+}
+
+
+// Drop the least recently used surfaces nobody uses until the loaded surfaces
+// fit into the budget again
+static void TrimAnimationSurfaces()
+{
+	for (INT32 victim; (victim = AnimationSurfaceToUnload()) != -1;)
+	{
+		SLOGD("Surface Database: Unloading Surface: {}", victim);
+		AnimationSurfaceType& a = gAnimSurfaceDatabase[victim];
+		DeleteVideoObject(a.hVideoObject);
+		a.hVideoObject = NULL;
+		guiAnimSurfaceBytes -= guiAnimSurfaceSize[victim];
+		guiAnimSurfaceSize[victim] = 0;
+	}
+}
+
+
+static void InstallAnimationSurface(UINT16 const usSurfaceIndex, SGPImage* const image, STRUCTURE_FILE_REF const* const pStructureFileRef)
+{
+	AnimationSurfaceType* const a = &gAnimSurfaceDatabase[usSurfaceIndex];
+
+	AutoSGPImage   hImage(image);
+	UINT32   const uiSize = hImage->uiSizePixData + hImage->usNumberOfObjects * sizeof(ETRLEObject);
+	AutoSGPVObject hVObject(AddVideoObjectFromHImage(hImage.get()));
+
+	// Get aux data
+	if (hImage->uiAppDataSize != hVObject->SubregionCount() * sizeof(AuxObjectData))
+	{
+		throw std::runtime_error("Invalid # of animations given");
+	}
+
+	// Valid auxiliary data, so get # of frames from data
+	AuxObjectData const* const pAuxData = (AuxObjectData const*)(UINT8 const*)hImage->pAppData;
+	a->uiNumFramesPerDir = pAuxData->ubNumberOfFrames;
+
+	// get structure data if any
+	if (pStructureFileRef != NULL)
+	{
+		INT16 sStartFrame = 0;
+		if (usSurfaceIndex == RGMPRONE)
+		{
+			sStartFrame = 5;
+		}
+		else if (usSurfaceIndex >= QUEENMONSTERSTANDING && usSurfaceIndex <= QUEENMONSTERSWIPE)
+		{
+			sStartFrame = -1;
+		}
+
+		AddZStripInfoToVObject(hVObject.get(), pStructureFileRef, TRUE, sStartFrame);
+	}
+
+	// Set video object index
+	a->hVideoObject = hVObject.release();
+	guiAnimSurfaceSize[usSurfaceIndex] = uiSize;
+	guiAnimSurfaceBytes += uiSize;
+	TouchAnimationSurface(usSurfaceIndex);
+
+	// Determine if we have a problem with #frames + directions ( ie mismatch )
+	if (a->uiNumDirections * a->uiNumFramesPerDir != a->hVideoObject->SubregionCount())
+	{
+		SLOGW("Surface Database: Surface {} has #frames mismatch.", usSurfaceIndex);
+	}
+
+	TrimAnimationSurfaces();
+}
+
+
+// Load a surface right now, taking over a background load if there is one
+static void LoadAnimationSurfaceNow(UINT16 const usSoldierID, UINT16 const usSurfaceIndex, UINT16 const usAnimState)
+{
+	AnimationSurfaceType* const a = &gAnimSurfaceDatabase[usSurfaceIndex];
+	try
+	{
+		// Load into memory
+		SLOGD("Surface Database: Loading {}", usSurfaceIndex);
+
+		STRUCTURE_FILE_REF const* structure = InternalGetAnimationStructureRef(ID2SOLDIER(usSoldierID), usSurfaceIndex, usAnimState, TRUE);
+		SGPImage* image = TakePrefetchedAnimationSurface(usSurfaceIndex, &structure);
+		if (!image) image = CreateImage(a->Filename, IMAGE_ALLDATA);
+		InstallAnimationSurface(usSurfaceIndex, image, structure);
+	}
+	catch (...)
+	{
+		SLOGE("Could not load animation file: {}", a->Filename);
+		throw;
+	}
+}
+
+
 // Surface mamagement functions
 void LoadAnimationSurface(UINT16 const usSoldierID, UINT16 const usSurfaceIndex, UINT16 const usAnimState)
 {
@@ -645,69 +915,131 @@ void LoadAnimationSurface(UINT16 const usSoldierID, UINT16 const usSurfaceIndex,
 	{
 		// just increment usage counter ( below )
 		SLOGD("Surface Database: Hit {}", usSurfaceIndex);
+		TouchAnimationSurface(usSurfaceIndex);
+	}
+	else if (IsAnimationSurfacePending(usSurfaceIndex))
+	{
+		// The background loader is working on it, the soldier is drawn with a
+		// placeholder frame until UpdateAnimationSurfacePrefetch() installs it
+		SLOGD("Surface Database: Pending {}", usSurfaceIndex);
 	}
 	else
 	{
-		try
+		LoadAnimationSurfaceNow(usSoldierID, usSurfaceIndex, usAnimState);
+	}
+
+	// Increment usage count only if history for soldier is not yet set
+	if (gbAnimUsageHistory[usSurfaceIndex][usSoldierID] == 0)
+	{
+		SLOGD("Surface Database: Incrementing Usage {} ( Soldier {} )", usSurfaceIndex, usSoldierID);
+		// Increment usage count
+		++a->bUsageCount;
+		// Set history for particular sodlier
+		++gbAnimUsageHistory[usSurfaceIndex][usSoldierID];
+	}
+}
+
+
+void CompleteAnimationSurface(UINT16 const usSoldierID, UINT16 const usSurfaceIndex, UINT16 const usAnimState)
+{
+	if (usSurfaceIndex >= NUMANIMATIONSURFACETYPES) return;
+	if (gAnimSurfaceDatabase[usSurfaceIndex].hVideoObject != NULL) return;
+	LoadAnimationSurfaceNow(usSoldierID, usSurfaceIndex, usAnimState);
+}
+
+
+void PrefetchAnimationSurface(UINT16 const usSoldierID, UINT16 const usSurfaceIndex, UINT16 const usAnimState)
+{
+	if (usSurfaceIndex >= NUMANIMATIONSURFACETYPES) return;
+	if (!gAnimSurfacePrefetchLoader.IsRunning()) return;
+
+	AnimationSurfaceType const& a = gAnimSurfaceDatabase[usSurfaceIndex];
+	if (a.hVideoObject != NULL)
+	{
+		TouchAnimationSurface(usSurfaceIndex);
+		return;
+	}
+
+	// Guesses must not push out surfaces that were actually used
+	if (guiAnimSurfaceBytes >= ANIM_SURFACE_BUDGET) return;
+
+	ST::string const filename{a.Filename};
+	if (filename.after_last(".").compare_i("STI") != 0) return;
+
+	std::unique_lock<std::mutex> lock(gAnimSurfacePrefetchMutex);
+	AnimSurfacePrefetch& p = gAnimSurfacePrefetch[usSurfaceIndex];
+	if (p.state != PrefetchState::None) return;
+	lock.unlock();
+
+	SGPFile* file;
+	try
+	{
+		file = GCM->openGameResForReading(filename);
+	}
+	catch (const std::exception& e)
+	{
+		SLOGW("Surface Database: Cannot prefetch {}: {}", usSurfaceIndex, e.what());
+		return;
+	}
+
+	lock.lock();
+	p.state     = PrefetchState::Queued;
+	p.file      = file;
+	p.structure = InternalGetAnimationStructureRef(ID2SOLDIER(usSoldierID), usSurfaceIndex, usAnimState, TRUE);
+	gAnimSurfacePrefetchQueue.push_back(usSurfaceIndex);
+	lock.unlock();
+	gAnimSurfacePrefetchWork.notify_one();
+}
+
+
+void UpdateAnimationSurfacePrefetch()
+{
+	for (UINT16 i = 0; i < NUMANIMATIONSURFACETYPES; ++i)
+	{
+		SGPImage*                 image;
+		STRUCTURE_FILE_REF const* structure;
 		{
-			// Load into memory
-			SLOGD("Surface Database: Loading {}", usSurfaceIndex);
+			std::lock_guard<std::mutex> lock(gAnimSurfacePrefetchMutex);
+			AnimSurfacePrefetch& p = gAnimSurfacePrefetch[i];
+			if (p.state != PrefetchState::Done) continue;
+			image     = p.image;
+			structure = p.structure;
+			p = AnimSurfacePrefetch{};
+		}
 
-			AutoSGPImage   hImage(CreateImage(a->Filename, IMAGE_ALLDATA));
-			AutoSGPVObject hVObject(AddVideoObjectFromHImage(hImage.get()));
+		AnimationSurfaceType const& a = gAnimSurfaceDatabase[i];
+		if (a.hVideoObject != NULL)
+		{
+			delete image;
+			continue;
+		}
 
-			// Get aux data
-			if (hImage->uiAppDataSize != hVObject->SubregionCount() * sizeof(AuxObjectData))
+		if (image)
+		{
+			try
 			{
-				throw std::runtime_error("Invalid # of animations given");
+				InstallAnimationSurface(i, image, structure);
+				continue;
 			}
-
-			// Valid auxiliary data, so get # of frames from data
-			AuxObjectData const* const pAuxData = (AuxObjectData const*)(UINT8 const*)hImage->pAppData;
-			a->uiNumFramesPerDir = pAuxData->ubNumberOfFrames;
-
-			// get structure data if any
-			const STRUCTURE_FILE_REF* const pStructureFileRef = InternalGetAnimationStructureRef(ID2SOLDIER(usSoldierID), usSurfaceIndex, usAnimState, TRUE);
-			if (pStructureFileRef != NULL)
+			catch (const std::exception& e)
 			{
-				INT16 sStartFrame = 0;
-				if (usSurfaceIndex == RGMPRONE)
-				{
-					sStartFrame = 5;
-				}
-				else if (usSurfaceIndex >= QUEENMONSTERSTANDING && usSurfaceIndex <= QUEENMONSTERSWIPE)
-				{
-					sStartFrame = -1;
-				}
-
-				AddZStripInfoToVObject(hVObject.get(), pStructureFileRef, TRUE, sStartFrame);
+				SLOGW("Surface Database: Prefetched surface {} is unusable: {}", i, e.what());
 			}
+		}
 
-			// Set video object index
-			a->hVideoObject = hVObject.release();
+		// Nobody waits for it, the next LoadAnimationSurface() loads it
+		if (a.bUsageCount == 0) continue;
 
-			// Determine if we have a problem with #frames + directions ( ie mismatch )
-			if (a->uiNumDirections * a->uiNumFramesPerDir != a->hVideoObject->SubregionCount())
-			{
-				SLOGW("Surface Database: Surface {} has #frames mismatch.", usSurfaceIndex);
-			}
+		// Somebody is already drawn with the placeholder, load it the old way
+		try
+		{
+			InstallAnimationSurface(i, CreateImage(a.Filename, IMAGE_ALLDATA), structure);
 		}
-		catch (...)
+		catch (const std::exception& e)
 		{
-			SLOGE("Could not load animation file: {}", a->Filename);
-			throw;
+			SLOGE("Could not load animation file: {}: {}", a.Filename, e.what());
 		}
 	}
-
-	// Increment usage count only if history for soldier is not yet set
-	if (gbAnimUsageHistory[usSurfaceIndex][usSoldierID] == 0)
-	{
-		SLOGD("Surface Database: Incrementing Usage {} ( Soldier {} )", usSurfaceIndex, usSoldierID);
-		// Increment usage count
-		++a->bUsageCount;
-		// Set history for particular sodlier
-		++gbAnimUsageHistory[usSurfaceIndex][usSoldierID];
-	}
 }
 
 
@@ -734,15 +1066,8 @@ void UnLoadAnimationSurface(const UINT16 usSoldierID, const UINT16 usSurfaceInde
 	Assert(*use_count >= 0);
 	if (*use_count < 0) *use_count = 0;
 
-	// Delete if count reched zero
-	if (*use_count == 0)
-	{
-		SLOGD("Surface Database: Unloading Surface: {}", usSurfaceIndex);
-		SGPVObject** const vo = &a->hVideoObject;
-		CHECKV(*vo != NULL);
-		DeleteVideoObject(*vo);
-		*vo = NULL;
-	}
+	// Keep it around for the next soldier who needs it, unless we are over budget
+	if (*use_count == 0) TrimAnimationSurfaces();
 }
 
 
@@ -827,12 +1152,84 @@ void ZeroAnimSurfaceCounts( )
 
 	for ( cnt = 0; cnt < NUMANIMATIONSURFACETYPES; cnt++ )
 	{
-		gAnimSurfaceDatabase[ cnt ].bUsageCount   = 0;
-		gAnimSurfaceDatabase[ cnt ].hVideoObject  = NULL;
+		// Surfaces nobody uses are only kept for the budget, really free them
+		AnimationSurfaceType& a = gAnimSurfaceDatabase[cnt];
+		if (a.hVideoObject && a.bUsageCount == 0) DeleteVideoObject(a.hVideoObject);
+		a.bUsageCount   = 0;
+		a.hVideoObject  = NULL;
+		guiAnimSurfaceSize[cnt] = 0;
 	}
+	guiAnimSurfaceBytes = 0;
 
 	for (auto& i : gbAnimUsageHistory)
 	{
 		std::fill(std::begin(i), std::end(i), 0);
 	}
 }
+
+
+#ifdef WITH_UNITTESTS
+#include "gtest/gtest.h"
+
+// Overfill the budget with stand-ins for loaded surfaces and check which ones
+// are picked to be dropped
+TEST(AnimationData, surfaceBudgetEviction)
+{
+	std::vector<std::pair<HVOBJECT, INT8>> saved_surfaces;
+	for (AnimationSurfaceType const& a : gAnimSurfaceDatabase)
+	{
+		saved_surfaces.emplace_back(a.hVideoObject, a.bUsageCount);
+	}
+	std::vector<UINT32> const saved_size(std::begin(guiAnimSurfaceSize), std::end(guiAnimSurfaceSize));
+	std::vector<UINT32> const saved_last_use(std::begin(guiAnimSurfaceLastUse), std::end(guiAnimSurfaceLastUse));
+	UINT32 const saved_bytes       = guiAnimSurfaceBytes;
+	UINT32 const saved_use_counter = guiAnimSurfaceUseCounter;
+
+	// Never dereferenced, only compared against NULL
+	static char stand_in;
+	SGPVObject* const loaded = reinterpret_cast<SGPVObject*>(&stand_in);
+	for (AnimationSurfaceType& a : gAnimSurfaceDatabase)
+	{
+		a.hVideoObject = NULL;
+		a.bUsageCount  = 0;
+	}
+	guiAnimSurfaceBytes = 0;
+	for (UINT16 const i : { 0, 1, 2, 3 })
+	{
+		gAnimSurfaceDatabase[i].hVideoObject = loaded;
+		guiAnimSurfaceSize[i] = ANIM_SURFACE_BUDGET / 2;
+		guiAnimSurfaceBytes  += ANIM_SURFACE_BUDGET / 2;
+	}
+	for (UINT16 const i : { 1, 3, 2, 0 }) TouchAnimationSurface(i);
+	// The least recently used one is still in use
+	gAnimSurfaceDatabase[1].bUsageCount = 1;
+
+	auto const unload = [](INT32 const i)
+	{
+		gAnimSurfaceDatabase[i].hVideoObject = NULL;
+		guiAnimSurfaceBytes -= guiAnimSurfaceSize[i];
+	};
+	ASSERT_EQ(AnimationSurfaceToUnload(), 3);
+	unload(3);
+	ASSERT_EQ(AnimationSurfaceToUnload(), 2);
+	unload(2);
+	// Exactly at the budget is fine
+	EXPECT_EQ(AnimationSurfaceToUnload(), -1);
+
+	// Surfaces in use are never dropped, even over the budget
+	gAnimSurfaceDatabase[0].bUsageCount = 1;
+	guiAnimSurfaceBytes += ANIM_SURFACE_BUDGET;
+	EXPECT_EQ(AnimationSurfaceToUnload(), -1);
+
+	for (size_t i = 0; i != saved_surfaces.size(); ++i)
+	{
+		gAnimSurfaceDatabase[i].hVideoObject = saved_surfaces[i].first;
+		gAnimSurfaceDatabase[i].bUsageCount  = saved_surfaces[i].second;
+	}
+	std::copy(saved_size.begin(), saved_size.end(), guiAnimSurfaceSize);
+	std::copy(saved_last_use.begin(), saved_last_use.end(), guiAnimSurfaceLastUse);
+	guiAnimSurfaceBytes      = saved_bytes;
+	guiAnimSurfaceUseCounter = saved_use_counter;
+}
+
+#endif
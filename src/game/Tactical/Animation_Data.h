@@ -534,6 +534,15 @@ void InitAnimationSystem(void);
 void DeInitAnimationSystem(void);
 void LoadAnimationSurface(UINT16 usSoldierID, UINT16 usSurfaceIndex, UINT16 usAnimState);
 void UnLoadAnimationSurface(UINT16 usSoldierID, UINT16 usSurfaceIndex);
+
+// Surfaces that are still being loaded in the background after
+// LoadAnimationSurface() have no video object yet.  Finish loading such a
+// surface right now, or load it again if the background load failed.
+void CompleteAnimationSurface(UINT16 usSoldierID, UINT16 usSurfaceIndex, UINT16 usAnimState);
+// Start loading a surface in the background, if it is not loaded yet
+void PrefetchAnimationSurface(UINT16 usSoldierID, UINT16 usSurfaceIndex, UINT16 usAnimState);
+// Turn the surfaces the background loader has finished into video objects
+void UpdateAnimationSurfacePrefetch(void);
 void ClearAnimationSurfacesUsageHistory( UINT16 usSoldierID );
 
 
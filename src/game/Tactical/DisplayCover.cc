@@ -20,12 +20,14 @@
 #include "StrategicMap.h"
 #include "Render_Fun.h"
 #include "Items.h"
+#include "CoverField.h"
 
 #include "ContentManager.h"
 #include "GameInstance.h"
 #include "WeaponModels.h"
 
 #include <algorithm>
+#include <vector>
 
 #define DC_MAX_COVER_RANGE		31
 
@@ -304,7 +306,7 @@ static INT8 CalcCoverForGridNoBasedOnTeamKnownEnemies(SOLDIERTYPE const* const p
 			continue;
 		}
 
-		INT32  const iGetThrough = SoldierToLocationChanceToGetThrough(pOpponent, sTargetGridNo,
+		INT32  const iGetThrough = CoverFieldChanceToGetThrough(pOpponent, sTargetGridNo,
 										pSoldier->bLevel, bStance, NULL);
 		UINT16 const usMaxRange = WeaponInHand(pOpponent) ? GunRange(pOpponent->inv[HANDPOS]) :
 						GCM->getWeapon(GLOCK_18)->usRange;
@@ -486,7 +488,7 @@ void DisplayGridNoVisibleToSoldierGrid( )
 }
 
 
-static INT8 CalcIfSoldierCanSeeGridNo(const SOLDIERTYPE* pSoldier, INT16 sTargetGridNo, BOOLEAN fRoof);
+static void AddSoldierCanSeeGridNoTests(const SOLDIERTYPE* pSoldier, INT16 sTargetGridNo, BOOLEAN fRoof, std::vector<VIRTUAL_SOLDIER_LOS_TEST>& tests);
 static BOOLEAN IsTheRoofVisible(INT16 sGridNo);
 
 
@@ -517,6 +519,11 @@ static void CalculateVisibleToSoldierAroundGridno(INT16 sTargetGridNo, int bSear
 
 	const SOLDIERTYPE* const pSoldier = GetCurrentMercForDisplayCover();
 
+	// The line of sight tests are all from the same soldier, so they are
+	// collected first and done in one batch
+	std::vector<VISIBLE_TO_SOLDIER_STRUCT*> cells;
+	std::vector<VIRTUAL_SOLDIER_LOS_TEST>  tests;
+
 	sCounterX=0;
 	sCounterY=0;
 
@@ -573,13 +580,24 @@ static void CalculateVisibleToSoldierAroundGridno(INT16 sTargetGridNo, int bSear
 			//Calculate the cover for this gridno
 			gCoverRadius[ sCounterX ][ sCounterY ].bCover = CalcCoverForGridNoBasedOnTeamKnownEnemies( pSoldier, sGridNo, bStance );*/
 
-			gVisibleToSoldierStruct[ sCounterX ][ sCounterY ].bVisibleToSoldier = CalcIfSoldierCanSeeGridNo( pSoldier, sGridNo, fRoof );
+			cells.push_back(&gVisibleToSoldierStruct[ sCounterX ][ sCounterY ]);
+			AddSoldierCanSeeGridNoTests( pSoldier, sGridNo, fRoof, tests );
 			gVisibleToSoldierStruct[ sCounterX ][ sCounterY ].fRoof = fRoof;
 			sCounterX++;
 		}
 
 		sCounterY++;
 	}
+
+	std::vector<INT32> results(tests.size());
+	SoldierToVirtualSoldierLineOfSightTests(pSoldier, tests.data(), tests.size(), results.data());
+
+	// one test for each of prone, crouched and standing
+	for (size_t i = 0; i != cells.size(); ++i)
+	{
+		INT32 const* const r = &results[i * 3];
+		cells[i]->bVisibleToSoldier = (r[0] != 0) + (r[1] != 0) + (r[2] != 0);
+	}
 }
 
 
@@ -696,10 +714,8 @@ void RemoveVisibleGridNoAtSelectedGridNo()
 }
 
 
-static INT8 CalcIfSoldierCanSeeGridNo(const SOLDIERTYPE* pSoldier, INT16 sTargetGridNo, BOOLEAN fRoof)
+static void AddSoldierCanSeeGridNoTests(const SOLDIERTYPE* pSoldier, INT16 sTargetGridNo, BOOLEAN fRoof, std::vector<VIRTUAL_SOLDIER_LOS_TEST>& tests)
 {
-	INT8    bRetVal=0;
-	INT32   iLosForGridNo=0;
 	UINT16  usSightLimit=0;
 	BOOLEAN bAware=FALSE;
 
@@ -719,34 +735,10 @@ static INT8 CalcIfSoldierCanSeeGridNo(const SOLDIERTYPE* pSoldier, INT16 sTarget
 
 	usSightLimit = DistanceVisible( pSoldier, DIRECTION_IRRELEVANT, DIRECTION_IRRELEVANT, sTargetGridNo, fRoof );
 
-	//
-	// Prone
-	//
-	iLosForGridNo = SoldierToVirtualSoldierLineOfSightTest( pSoldier, sTargetGridNo, fRoof, ANIM_PRONE, (UINT8)usSightLimit, bAware );
-	if( iLosForGridNo != 0 )
-	{
-		bRetVal++;
-	}
-
-	//
-	// Crouch
-	//
-	iLosForGridNo = SoldierToVirtualSoldierLineOfSightTest( pSoldier, sTargetGridNo, fRoof, ANIM_CROUCH, (UINT8)usSightLimit, bAware );
-	if( iLosForGridNo != 0 )
-	{
-		bRetVal++;
-	}
-
-	//
-	// Standing
-	//
-	iLosForGridNo = SoldierToVirtualSoldierLineOfSightTest( pSoldier, sTargetGridNo, fRoof, ANIM_STAND, (UINT8)usSightLimit, bAware );
-	if( iLosForGridNo != 0 )
-	{
-		bRetVal++;
-	}
-
-	return( bRetVal );
+	// Prone, crouch and standing
+	tests.push_back(VIRTUAL_SOLDIER_LOS_TEST{ sTargetGridNo, INT8(fRoof), ANIM_PRONE,  (UINT8)usSightLimit, INT8(bAware) });
+	tests.push_back(VIRTUAL_SOLDIER_LOS_TEST{ sTargetGridNo, INT8(fRoof), ANIM_CROUCH, (UINT8)usSightLimit, INT8(bAware) });
+	tests.push_back(VIRTUAL_SOLDIER_LOS_TEST{ sTargetGridNo, INT8(fRoof), ANIM_STAND,  (UINT8)usSightLimit, INT8(bAware) });
 }
 
 
@@ -70,6 +70,8 @@
 #include <string_theory/format>
 #include <string_theory/string>
 
+#include <deque>
+
 
 #define NUM_ITEMS_LISTED		8
 #define NUM_ITEM_FLASH_SLOTS		50
@@ -1438,6 +1440,35 @@ INT32 AddItemToPool(INT16 sGridNo, OBJECTTYPE* const pObject, Visibility const b
 static void HandleItemObscuredFlag(INT16 sGridNo, UINT8 ubLevel);
 
 
+// Item pool nodes are kept in blocks and recycled instead of being allocated
+// one by one, sectors can have thousands of items lying around
+static std::deque<ITEM_POOL> gItemPoolNodes;
+static ITEM_POOL*            gFreeItemPoolNodes = NULL;
+
+
+static ITEM_POOL* NewItemPoolNode()
+{
+	ITEM_POOL* node = gFreeItemPoolNodes;
+	if (node != NULL)
+	{
+		gFreeItemPoolNodes = node->pNext;
+	}
+	else
+	{
+		node = &gItemPoolNodes.emplace_back();
+	}
+	*node = ITEM_POOL{};
+	return node;
+}
+
+
+static void DeleteItemPoolNode(ITEM_POOL* const node)
+{
+	node->pNext        = gFreeItemPoolNodes;
+	gFreeItemPoolNodes = node;
+}
+
+
 INT32 InternalAddItemToPool(INT16* const psGridNo, OBJECTTYPE* const pObject, Visibility bVisible, UINT8 ubLevel, UINT16 usFlags, INT8 bRenderZHeightAboveLevel)
 {
 	Assert(pObject->ubNumberOfObjects <= MAX_OBJECTS_PER_SLOT);
@@ -1594,7 +1625,7 @@ INT32 InternalAddItemToPool(INT16* const psGridNo, OBJECTTYPE* const pObject, Vi
 
 	// Check for and existing pool on the object layer
 
-	ITEM_POOL* const new_item = new ITEM_POOL{};
+	ITEM_POOL* const new_item = NewItemPoolNode();
 	new_item->pNext      = NULL;
 	new_item->iItemIndex = iWorldItem;
 
@@ -1889,7 +1920,7 @@ void RemoveItemFromPool(WORLDITEM& wi)
 	}
 
 	RemoveItemFromWorld(item->iItemIndex);
-	delete item;
+	DeleteItemPoolNode(item);
 }
 
 
@@ -3096,13 +3127,9 @@ BOOLEAN NearbyGroundSeemsWrong(SOLDIERTYPE* const s, const INT16 sGridNo, const
 		if (pMapElement->uiFlags & fCheckFlag) continue;
 
 		// check for boobytraps
-		CFOR_EACH_WORLD_BOMB(wb)
+		for (UINT32 const bomb : GetWorldBombsInGridNo(sNextGridNo))
 		{
-			WORLDITEM& wi = GetWorldItem(wb.iItemIndex);
-			if (wi.sGridNo != sNextGridNo)
-				continue;
-
-			OBJECTTYPE& o = wi.o;
+			OBJECTTYPE& o = GetWorldItem(gWorldBombs[bomb].iItemIndex).o;
 			if (o.bDetonatorType != BOMB_PRESSURE)
 				continue;
 			if (o.fFlags & OBJECT_KNOWN_TO_BE_TRAPPED)
@@ -2294,7 +2294,7 @@ void HandleNPCDoAction( UINT8 ubTargetNPC, UINT16 usActionCode, UINT8 ubQuoteNum
 					pDoor = FindDoorInfoAtGridNo( sGridNo );
 					if (pDoor)
 					{
-						pDoor->fLocked = FALSE;
+						pDoor->setLocked(false);
 					}
 				}
 				/*
@@ -4639,7 +4639,7 @@ static BOOLEAN NPCOpenThing(SOLDIERTYPE* pSoldier, BOOLEAN fDoor)
 	pDoor = FindDoorInfoAtGridNo( sStructGridNo );
 	if ( pDoor )
 	{
-		pDoor->fLocked = FALSE;
+		pDoor->setLocked(false);
 	}
 
 	sActionGridNo =  FindAdjacentGridEx( pSoldier, sStructGridNo, &ubDirection, NULL, FALSE, TRUE );
@@ -81,6 +81,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <string.h>
 
 #define ITEMDESC_FONT					BLOCKFONT2
 #define ITEMDESC_FONTSHADOW2				32
@@ -405,6 +406,7 @@ struct REMOVE_MONEY
 static REMOVE_MONEY gRemoveMoney;
 
 static MOUSE_REGION gSMInvRegion[NUM_INV_SLOTS];
+static InvSlotLook  gSMInvLook[NUM_INV_SLOTS];
 static MOUSE_REGION gKeyRingPanel;
 static MOUSE_REGION gSMInvCamoRegion;
 static INT8 gbCompatibleAmmo[NUM_INV_SLOTS];
@@ -791,6 +793,24 @@ void RenderInvBodyPanel(const SOLDIERTYPE* pSoldier, INT16 sX, INT16 sY)
 }
 
 
+bool InvSlotNeedsRender(InvSlotLook& look, SOLDIERTYPE const& s, OBJECTTYPE const& o, DirtyLevel const dirty_level)
+{
+	// Compared bytewise, so clear the padding
+	InvSlotLook now;
+	memset(&now, 0, sizeof(now));
+	now.merc          = &s;
+	now.screen        = guiCurrentScreen;
+	memcpy(&now.o, &o, sizeof(now.o));
+	now.bWeaponMode   = s.bWeaponMode;
+	now.uiStatusFlags = s.uiStatusFlags & (SOLDIER_DEAD | SOLDIER_DRIVER | SOLDIER_PASSENGER);
+
+	if (dirty_level != DIRTYLEVEL2 && memcmp(&now, &look, sizeof(now)) == 0) return false;
+
+	if (dirty_level != DIRTYLEVEL0) memcpy(&look, &now, sizeof(look));
+	return true;
+}
+
+
 static void INVRenderINVPanelItem(SOLDIERTYPE const& s, INT16 const pocket, DirtyLevel const dirty_level)
 {
 	guiCurrentItemDescriptionScreen = guiCurrentScreen;
@@ -830,13 +850,24 @@ static void INVRenderINVPanelItem(SOLDIERTYPE const& s, INT16 const pocket, Dirt
 	INT16 const x = r.X();
 	INT16 const y = r.Y();
 
-	// Now render as normal
-	DirtyLevel const render_dirty_level =
-		s.bNewItemCount[pocket] <= 0 ||
-		gsCurInterfacePanel != SM_PANEL ||
-		fInterfacePanelDirty == DIRTYLEVEL2 ? dirty_level :
-		DIRTYLEVEL0; // We have a new item and we are in the right panel
-	INVRenderItem(guiSAVEBUFFER, &s, o, x, y, r.W(), r.H(), render_dirty_level, 0, outline);
+	// Newly added items flash, so they are always rendered
+	if (InvSlotNeedsRender(gSMInvLook[pocket], s, o, dirty_level) || s.bNewItemCount[pocket] > 0)
+	{
+		// Now render as normal
+		DirtyLevel const render_dirty_level =
+			s.bNewItemCount[pocket] <= 0 ||
+			gsCurInterfacePanel != SM_PANEL ||
+			fInterfacePanelDirty == DIRTYLEVEL2 ? dirty_level :
+			DIRTYLEVEL0; // We have a new item and we are in the right panel
+		INVRenderItem(guiSAVEBUFFER, &s, o, x, y, r.W(), r.H(), render_dirty_level, 0, outline);
+
+		if (o.usItem != NOTHING)
+		{
+			// Add item status bar
+			DrawItemUIBarEx(o, 0, x - INV_BAR_DX, y + INV_BAR_DY, ITEM_BAR_HEIGHT, Get16BPPColor(STATUS_BAR),
+					Get16BPPColor(STATUS_BAR_SHADOW), guiSAVEBUFFER);
+		}
+	}
 
 	if (gbInvalidPlacementSlot[pocket])
 	{
@@ -860,13 +891,6 @@ static void INVRenderINVPanelItem(SOLDIERTYPE const& s, INT16 const pocket, Dirt
 		SGPVSurface* const dst = in_map ? guiSAVEBUFFER : FRAME_BUFFER;
 		DrawHatchOnInventory(dst, x, y, r.W(), r.H());
 	}
-
-	if (o.usItem != NOTHING)
-	{
-		// Add item status bar
-		DrawItemUIBarEx(o, 0, x - INV_BAR_DX, y + INV_BAR_DY, ITEM_BAR_HEIGHT, Get16BPPColor(STATUS_BAR),
-				Get16BPPColor(STATUS_BAR_SHADOW), guiSAVEBUFFER);
-	}
 }
 
 
@@ -6,6 +6,7 @@
 #include "MouseSystem.h"
 #include "Soldier_Control.h"
 
+#include "ScreenIDs.h"
 #include "UILayout.h"
 
 #include <string_theory/string>
@@ -62,6 +63,22 @@ BOOLEAN HandleCompatibleAmmoUI(const SOLDIERTYPE* pSoldier, INT8 bInvPos, BOOLEA
 //  Last parameter used mainly for when mouse is over item
 void INVRenderItem(SGPVSurface* uiBuffer, SOLDIERTYPE const* pSoldier, OBJECTTYPE const&, INT16 sX, INT16 sY, INT16 sWidth, INT16 sHeight, DirtyLevel, UINT8 ubStatusIndex, INT16 sOutlineColor);
 
+// What an inventory slot on a panel showed when it was last rendered.  Below
+// DIRTYLEVEL2 a slot only needs to be rendered again if something it shows
+// has changed since, otherwise the frame buffer still holds it.
+struct InvSlotLook
+{
+	SOLDIERTYPE const* merc;
+	ScreenID           screen;
+	OBJECTTYPE         o;
+	INT8               bWeaponMode;
+	UINT32             uiStatusFlags;
+};
+
+// Returns whether the slot has to be rendered.  The look is updated on
+// DIRTYLEVEL1 and DIRTYLEVEL2 only, as DIRTYLEVEL0 does not render the text.
+bool InvSlotNeedsRender(InvSlotLook&, SOLDIERTYPE const&, OBJECTTYPE const&, DirtyLevel);
+
 
 extern BOOLEAN gfInItemDescBox;
 
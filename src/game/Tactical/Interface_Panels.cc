@@ -337,6 +337,8 @@ struct TeamPanelSlot
 	MOUSE_REGION left_bars;
 	MOUSE_REGION first_hand;
 	MOUSE_REGION second_hand;
+	InvSlotLook  first_hand_look;
+	InvSlotLook  second_hand_look;
 };
 
 static std::vector<TeamPanelSlot> gTeamPanel;
@@ -2354,7 +2356,7 @@ static void RenderTeamSlotBorder(const SOLDIERTYPE* const s, const INT32 dx, con
 }
 
 
-static void RenderSoldierTeamInv(SOLDIERTYPE const&, INT16 x, INT16 y, DirtyLevel);
+static void RenderSoldierTeamInv(TeamPanelSlot&, INT16 x, INT16 y, DirtyLevel);
 static void UpdateTEAMPanel(void);
 
 
@@ -2490,7 +2492,7 @@ void RenderTEAMPanel(DirtyLevel const dirty_level)
 				}
 			}
 
-			RenderSoldierTeamInv(*s, dx + TM_INV_HAND1STARTX, dy + TM_INV_HAND1STARTY, dirty_level);
+			RenderSoldierTeamInv(i, dx + TM_INV_HAND1STARTX, dy + TM_INV_HAND1STARTY, dirty_level);
 		}
 		dx += TM_INV_HAND_SEP;
 	}
@@ -3017,34 +3019,41 @@ void HandlePanelFaceAnimations(SOLDIERTYPE* pSoldier)
 }
 
 
-static void RenderSoldierTeamInv(SOLDIERTYPE const& s, INT16 const x, INT16 y, DirtyLevel const dirty_level)
+static void RenderSoldierTeamInv(TeamPanelSlot& slot, INT16 const x, INT16 y, DirtyLevel const dirty_level)
 {
+	SOLDIERTYPE const& s = *slot.merc;
 	if (s.uiStatusFlags & SOLDIER_DEAD) return;
 
 	SGPVSurface* const buf = guiSAVEBUFFER;
 	INT16        const w   = TM_INV_WIDTH;
 	INT16        const h   = TM_INV_HEIGHT;
-	if (s.uiStatusFlags & SOLDIER_DRIVER)
+	if (InvSlotNeedsRender(slot.first_hand_look, s, s.inv[HANDPOS], dirty_level))
 	{
-		BltVideoObject(buf, guiVEHINV, 0, x, y);
-		RestoreExternBackgroundRect(x, y, w, h);
-	}
-	else
-	{
-		// Look in primary hand
-		INVRenderItem(buf, &s, s.inv[HANDPOS], x, y, w, h, dirty_level, 0, SGP_TRANSPARENT);
+		if (s.uiStatusFlags & SOLDIER_DRIVER)
+		{
+			BltVideoObject(buf, guiVEHINV, 0, x, y);
+			RestoreExternBackgroundRect(x, y, w, h);
+		}
+		else
+		{
+			// Look in primary hand
+			INVRenderItem(buf, &s, s.inv[HANDPOS], x, y, w, h, dirty_level, 0, SGP_TRANSPARENT);
+		}
 	}
 
 	y += TM_INV_HAND_SEPY;
-	if (s.uiStatusFlags & (SOLDIER_PASSENGER | SOLDIER_DRIVER))
+	if (InvSlotNeedsRender(slot.second_hand_look, s, s.inv[SECONDHANDPOS], dirty_level))
 	{
-		BltVideoObject(buf, guiVEHINV, 1, x, y);
-		RestoreExternBackgroundRect(x, y, w, h);
-	}
-	else
-	{
-		// Do secondary hand
-		INVRenderItem(buf, &s, s.inv[SECONDHANDPOS], x, y, w, h, dirty_level, 0, SGP_TRANSPARENT);
+		if (s.uiStatusFlags & (SOLDIER_PASSENGER | SOLDIER_DRIVER))
+		{
+			BltVideoObject(buf, guiVEHINV, 1, x, y);
+			RestoreExternBackgroundRect(x, y, w, h);
+		}
+		else
+		{
+			// Do secondary hand
+			INVRenderItem(buf, &s, s.inv[SECONDHANDPOS], x, y, w, h, dirty_level, 0, SGP_TRANSPARENT);
+		}
 	}
 }
 
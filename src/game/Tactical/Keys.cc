@@ -35,6 +35,7 @@
 #include "Game_Clock.h"
 #include "Handle_Doors.h"
 #include "Map_Screen_Interface.h"
+#include "PathAI.h"
 
 #include "ContentManager.h"
 #include "GameInstance.h"
@@ -162,7 +163,7 @@ static void DoLockDoor(DOOR* pDoor, UINT8 ubKeyID)
 	// if the door is unlocked and this is the right key, lock the door
 	if (!(pDoor->fLocked) && ValidKey( pDoor, ubKeyID ))
 	{
-		pDoor->fLocked = TRUE;
+		pDoor->setLocked(true);
 	}
 }
 
@@ -175,7 +176,7 @@ static void DoUnlockDoor(DOOR* pDoor, UINT8 ubKeyID)
 		// Play lockpicking
 		PlayLocationJA2Sample(pDoor->sGridNo, UNLOCK_DOOR_1, MIDVOLUME, 1);
 
-		pDoor->fLocked = FALSE;
+		pDoor->setLocked(false);
 	}
 }
 
@@ -420,7 +421,7 @@ BOOLEAN AttemptToPickLock( SOLDIERTYPE * pSoldier, DOOR * pDoor )
 		StatChange(*pSoldier, DEXTAMT, pLock->ubPickDifficulty / 10, FROM_SUCCESS);
 
 		// succeeded!
-		pDoor->fLocked = FALSE;
+		pDoor->setLocked(false);
 		return( TRUE );
 	}
 	else
@@ -681,6 +682,14 @@ bool DOOR::damageLock(int const additionalDamage)
 	return false;
 }
 
+void DOOR::setLocked(bool const locked)
+{
+	if (!fLocked == !locked) return;
+
+	fLocked = locked;
+	InvalidateReachableComponentsAt(sGridNo);
+}
+
 //File I/O for loading the door information from the map.  This automatically allocates
 //the exact number of slots when loading.
 void LoadDoorTableFromMap(HWFILE const f)
@@ -731,11 +740,13 @@ void AddDoorInfoToTable( DOOR *pDoor )
 	{
 		if (d.sGridNo != pDoor->sGridNo) continue;
 		d = *pDoor;
+		InvalidateReachableComponentsAt(d.sGridNo);
 		return;
 	}
 
 	//no existing door found, so add a new one.
 	DoorTable.push_back(*pDoor);
+	InvalidateReachableComponentsAt(pDoor->sGridNo);
 }
 
 //When the editor removes a door from the world, this function looks for and removes accompanying door
@@ -748,6 +759,7 @@ void RemoveDoorInfoFromTable( INT32 iMapIndex )
 		if (DoorTable[ i ].sGridNo == iMapIndex)
 		{
 			DoorTable.erase(DoorTable.begin() + i);
+			InvalidateReachableComponentsAt(iMapIndex);
 			return;
 		}
 	}
@@ -767,6 +779,7 @@ DOOR* FindDoorInfoAtGridNo( INT32 iMapIndex )
 void TrashDoorTable()
 {
 	DoorTable.clear();
+	ResetReachableComponents();
 }
 
 void UpdateDoorPerceivedValue( DOOR *pDoor )
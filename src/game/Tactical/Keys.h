@@ -66,6 +66,10 @@ struct DOOR
 	// and displays a message if the lock was destroyed.
 	// Returns true if the lock was destroyed, false otherwise.
 	bool damageLock(int const additionalDamage);
+
+	// Lock or unlock the door.  Every write to fLocked has to go through here,
+	// the reachable components the path AI remembers depend on it.
+	void setLocked(bool locked);
 };
 
 
@@ -1,4 +1,7 @@
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <vector>
 
 #include "Font_Control.h"
 #include "Handle_Items.h"
@@ -562,6 +565,45 @@ static BOOLEAN ResolveHitOnWall(STRUCTURE* pStructure, INT32 iGridNo, INT8 bLOSI
 
 
 
+// The part of a line of sight test which only depends on where it starts, so
+// it can be shared by all the tests from one spot
+struct LOSOrigin
+{
+	FLOAT   dStartX;
+	FLOAT   dStartY;
+	FLOAT   dStartZ;
+	FIXEDPT qStartZ;
+	FIXEDPT qWallHeight;
+	INT32   iStartCubesZ;
+	INT32   iStartCubesAboveLevelZ;
+};
+
+
+static LOSOrigin MakeLOSOrigin(GridNo const start_pos, FLOAT const dStartZ)
+{
+	INT16 start_cell_x;
+	INT16 start_cell_y;
+	ConvertGridNoToCenterCellXY(start_pos, &start_cell_x, &start_cell_y);
+
+	LOSOrigin o;
+	o.dStartX = start_cell_x;
+	o.dStartY = start_cell_y;
+	o.dStartZ = dStartZ;
+	o.qStartZ = FloatToFixed(dStartZ);
+
+	INT32   const iGridNo     = GETWORLDINDEXFROMWORLDCOORDS((INT32)o.dStartX, (INT32)o.dStartY);
+	FIXEDPT const qLandHeight = INT32_TO_FIXEDPT(CONVERT_PIXELS_TO_HEIGHTUNITS(gpWorldLevelData[iGridNo].sHeight));
+	o.iStartCubesZ = CONVERT_HEIGHTUNITS_TO_INDEX(FIXEDPT_TO_INT32(o.qStartZ - qLandHeight));
+	o.iStartCubesAboveLevelZ = o.iStartCubesZ;
+	if (o.iStartCubesAboveLevelZ >= STRUCTURE_ON_GROUND_MAX)
+	{
+		o.iStartCubesAboveLevelZ -= STRUCTURE_ON_ROOF;
+	}
+	o.qWallHeight = gqStandardWallHeight + qLandHeight;
+	return o;
+}
+
+
 // The line of sight code is now used to simulate smelling through the air (for monsters);
 // It obeys the following rules:
 // - ignores trees and vegetation
@@ -576,7 +618,7 @@ static BOOLEAN ResolveHitOnWall(STRUCTURE* pStructure, INT32 iGridNo, INT8 bLOSI
 // - starts at height relative to stance
 // - ignores windows
 // - stops at other obstacles
-static INT32 LineOfSightTest(GridNo start_pos, FLOAT dStartZ, GridNo end_pos, FLOAT dEndZ, UINT8 ubTileSightLimit, UINT8 ubTreeSightReduction, INT8 bAware, INT8 bCamouflage, BOOLEAN fSmell, INT16* psWindowGridNo)
+static INT32 TraceLineOfSight(LOSOrigin const& o, GridNo end_pos, FLOAT dEndZ, UINT8 ubTileSightLimit, UINT8 ubTreeSightReduction, INT8 bAware, INT8 bCamouflage, BOOLEAN fSmell, INT16* psWindowGridNo)
 {
 	// Parameters...
 	// the X,Y,Z triplets should be obvious
@@ -607,9 +649,9 @@ static INT32 LineOfSightTest(GridNo start_pos, FLOAT dStartZ, GridNo end_pos, FL
 	FIXEDPT qLandHeight;
 	INT32 iCurrAboveLevelZ;
 	INT32 iCurrCubesAboveLevelZ;
-	INT32 iStartCubesAboveLevelZ;
+	INT32 const iStartCubesAboveLevelZ = o.iStartCubesAboveLevelZ;
 	INT32 iEndCubesAboveLevelZ;
-	INT32 iStartCubesZ;
+	INT32 const iStartCubesZ = o.iStartCubesZ;
 	INT32 iEndCubesZ;
 
 	INT16 sDesiredLevel;
@@ -676,11 +718,9 @@ static INT32 LineOfSightTest(GridNo start_pos, FLOAT dStartZ, GridNo end_pos, FL
 	// hack end location to the centre of the tile, because there was a problem
 	// seeing a presumably off-centre merc...
 
-	INT16 start_cell_x;
-	INT16 start_cell_y;
-	ConvertGridNoToCenterCellXY(start_pos, &start_cell_x, &start_cell_y);
-	const float dStartX = start_cell_x;
-	const float dStartY = start_cell_y;
+	const float dStartX = o.dStartX;
+	const float dStartY = o.dStartY;
+	const float dStartZ = o.dStartZ;
 
 	INT16 end_cell_x;
 	INT16 end_cell_y;
@@ -733,21 +773,11 @@ static INT32 LineOfSightTest(GridNo start_pos, FLOAT dStartZ, GridNo end_pos, FL
 
 	fCheckForRoof = FALSE;
 
-	// figure out starting and ending cubes
-	iGridNo = GETWORLDINDEXFROMWORLDCOORDS( (INT32)dStartX, (INT32)dStartY );
-	qCurrZ = FloatToFixed( dStartZ );
-	qLandHeight = INT32_TO_FIXEDPT( CONVERT_PIXELS_TO_HEIGHTUNITS( gpWorldLevelData[ iGridNo ].sHeight ) );
-	iCurrAboveLevelZ = FIXEDPT_TO_INT32( qCurrZ - qLandHeight );
-
-	iStartCubesZ = CONVERT_HEIGHTUNITS_TO_INDEX( iCurrAboveLevelZ );
-	iStartCubesAboveLevelZ = iStartCubesZ;
-	if (iStartCubesAboveLevelZ >= STRUCTURE_ON_GROUND_MAX)
-	{
-		iStartCubesAboveLevelZ -= STRUCTURE_ON_ROOF;
-	}
+	// the starting cubes come with the origin
+	qCurrZ = o.qStartZ;
 
 	// check to see if we need to check for roofs based on the starting gridno
-	qWallHeight = gqStandardWallHeight + qLandHeight;
+	qWallHeight = o.qWallHeight;
 	if ( qCurrZ < qWallHeight )
 	{
 		// possibly going up through a roof on this level
@@ -1302,6 +1332,12 @@ static INT32 LineOfSightTest(GridNo start_pos, FLOAT dStartZ, GridNo end_pos, FL
 }
 
 
+static INT32 LineOfSightTest(GridNo start_pos, FLOAT dStartZ, GridNo end_pos, FLOAT dEndZ, UINT8 ubTileSightLimit, UINT8 ubTreeSightReduction, INT8 bAware, INT8 bCamouflage, BOOLEAN fSmell, INT16* psWindowGridNo)
+{
+	return TraceLineOfSight(MakeLOSOrigin(start_pos, dStartZ), end_pos, dEndZ, ubTileSightLimit, ubTreeSightReduction, bAware, bCamouflage, fSmell, psWindowGridNo);
+}
+
+
 BOOLEAN CalculateSoldierZPos(const SOLDIERTYPE* pSoldier, UINT8 ubPosType, FLOAT* pdZPos)
 {
 	UINT8 ubHeight;
@@ -1705,16 +1741,10 @@ INT32 SoldierToBodyPartLineOfSightTest( const SOLDIERTYPE * pStartSoldier, INT16
 }
 
 
-INT32 SoldierToVirtualSoldierLineOfSightTest(const SOLDIERTYPE* pStartSoldier, INT16 sGridNo, INT8 bLevel, INT8 bStance, UINT8 ubTileSightLimit, INT8 bAware)
+// Z position of the eyes of a soldier who isn't there
+static BOOLEAN CalculateVirtualSoldierZPos(INT16 const sGridNo, INT8 const bLevel, INT8 const bStance, FLOAT* const pdZPos)
 {
-	FLOAT dStartZPos, dEndZPos;
-	BOOLEAN fOk;
-
-	CHECKF( pStartSoldier );
-
-	fOk = CalculateSoldierZPos( pStartSoldier, LOS_POS, &dStartZPos );
-	CHECKF( fOk );
-
+	FLOAT dEndZPos;
 	// manually calculate destination Z position.
 	switch( bStance )
 	{
@@ -1736,10 +1766,111 @@ INT32 SoldierToVirtualSoldierLineOfSightTest(const SOLDIERTYPE* pStartSoldier, I
 		// on a roof
 		dEndZPos += WALL_HEIGHT_UNITS;
 	}
+	*pdZPos = dEndZPos;
+	return( TRUE );
+}
+
+
+INT32 SoldierToVirtualSoldierLineOfSightTest(const SOLDIERTYPE* pStartSoldier, INT16 sGridNo, INT8 bLevel, INT8 bStance, UINT8 ubTileSightLimit, INT8 bAware)
+{
+	FLOAT dStartZPos, dEndZPos;
+	BOOLEAN fOk;
+
+	CHECKF( pStartSoldier );
+
+	fOk = CalculateSoldierZPos( pStartSoldier, LOS_POS, &dStartZPos );
+	CHECKF( fOk );
+
+	if (!CalculateVirtualSoldierZPos(sGridNo, bLevel, bStance, &dEndZPos)) return( FALSE );
 
 	return LineOfSightTest(pStartSoldier->sGridNo, dStartZPos, sGridNo, dEndZPos, ubTileSightLimit, gubTreeSightReduction[ANIM_STAND], bAware, 0, FALSE, NULL);
 }
 
+
+void SoldierToVirtualSoldierLineOfSightTests(const SOLDIERTYPE* const pStartSoldier, const VIRTUAL_SOLDIER_LOS_TEST* const pTests, size_t const n, INT32* const piResults)
+{
+	std::fill_n(piResults, n, 0);
+
+	FLOAT dStartZPos;
+	if (!pStartSoldier || !CalculateSoldierZPos(pStartSoldier, LOS_POS, &dStartZPos)) return;
+	if (gTacticalStatus.uiFlags & DISALLOW_SIGHT) return;
+
+	LOSOrigin const o = MakeLOSOrigin(pStartSoldier->sGridNo, dStartZPos);
+	INT32     const iStartX = (INT32)o.dStartX;
+	INT32     const iStartY = (INT32)o.dStartY;
+
+	// Cull the targets which are out of sight range on the map plane alone
+	// before tracing.  The 3D distance of the trace can only be longer, and
+	// allowing for one more step than the sight limit keeps the float rounding
+	// of the trace on the safe side, so no visible target is culled.
+	std::vector<size_t> traced;
+	traced.reserve(n);
+	for (size_t i = 0; i != n; ++i)
+	{
+		VIRTUAL_SOLDIER_LOS_TEST const& t = pTests[i];
+		INT16 sEndX;
+		INT16 sEndY;
+		ConvertGridNoToCenterCellXY(t.sGridNo, &sEndX, &sEndY);
+		INT32 const iDeltaX = sEndX - iStartX;
+		INT32 const iDeltaY = sEndY - iStartY;
+		INT32 const iLimit  = t.ubTileSightLimit * CELL_X_SIZE + 1;
+		if (iDeltaX * iDeltaX + iDeltaY * iDeltaY > iLimit * iLimit) continue;
+		traced.push_back(i);
+	}
+
+	for (size_t const i : traced)
+	{
+		VIRTUAL_SOLDIER_LOS_TEST const& t = pTests[i];
+		FLOAT dEndZPos;
+		if (!CalculateVirtualSoldierZPos(t.sGridNo, t.bLevel, t.bStance, &dEndZPos)) continue;
+		piResults[i] = TraceLineOfSight(o, t.sGridNo, dEndZPos, t.ubTileSightLimit, gubTreeSightReduction[ANIM_STAND], t.bAware, 0, FALSE, NULL);
+	}
+}
+
+
+void BenchmarkLineOfSight(const SOLDIERTYPE* const s)
+{
+	if (!s || s->sGridNo == NOWHERE) return;
+
+	using Clock = std::chrono::steady_clock;
+	static INT8 const stances[] = { ANIM_PRONE, ANIM_CROUCH, ANIM_STAND };
+	INT16 const sX = s->sGridNo % WORLD_COLS;
+	INT16 const sY = s->sGridNo / WORLD_COLS;
+
+	for (UINT8 const ubRadius : { 5, 10, 15, 20, 25 })
+	{
+		// every tile in the square around the soldier, as seen by the cover display
+		std::vector<VIRTUAL_SOLDIER_LOS_TEST> tests;
+		for (INT16 y = std::max(0, sY - ubRadius); y <= std::min(WORLD_ROWS - 1, sY + ubRadius); ++y)
+		{
+			for (INT16 x = std::max(0, sX - ubRadius); x <= std::min(WORLD_COLS - 1, sX + ubRadius); ++x)
+			{
+				for (INT8 const bStance : stances)
+				{
+					tests.push_back(VIRTUAL_SOLDIER_LOS_TEST{ INT16(x + y * WORLD_COLS), s->bLevel, bStance, ubRadius, TRUE });
+				}
+			}
+		}
+
+		std::vector<INT32> scalar(tests.size());
+		std::vector<INT32> batched(tests.size());
+		Clock::time_point const t0 = Clock::now();
+		for (size_t i = 0; i != tests.size(); ++i)
+		{
+			VIRTUAL_SOLDIER_LOS_TEST const& t = tests[i];
+			scalar[i] = SoldierToVirtualSoldierLineOfSightTest(s, t.sGridNo, t.bLevel, t.bStance, t.ubTileSightLimit, t.bAware);
+		}
+		Clock::time_point const t1 = Clock::now();
+		SoldierToVirtualSoldierLineOfSightTests(s, tests.data(), tests.size(), batched.data());
+		Clock::time_point const t2 = Clock::now();
+
+		auto const us = [](Clock::duration const d) { return std::chrono::duration_cast<std::chrono::microseconds>(d).count(); };
+		SLOGI("LOS benchmark, radius {}: {} tests, single {} us, batched {} us{}",
+			ubRadius, tests.size(), us(t1 - t0), us(t2 - t1),
+			scalar == batched ? "" : ", RESULTS DIFFER");
+	}
+}
+
 INT32 SoldierToLocationLineOfSightTest( SOLDIERTYPE * pStartSoldier, INT16 sGridNo, UINT8 ubTileSightLimit, INT8 bAware )
 {
 	return( SoldierTo3DLocationLineOfSightTest( pStartSoldier, sGridNo, 0, 0, ubTileSightLimit, bAware ) );
@@ -55,6 +55,24 @@ INT32 SoldierToLocationLineOfSightTest( SOLDIERTYPE * pStartSoldier, INT16 sGrid
 INT32 SoldierTo3DLocationLineOfSightTest(const SOLDIERTYPE* pStartSoldier, INT16 sGridNo, INT8 bLevel, INT8 bCubeLevel, UINT8 ubTileSightLimit, INT8 bAware);
 INT32 SoldierToBodyPartLineOfSightTest( const SOLDIERTYPE * pStartSoldier, INT16 sGridNo, INT8 bLevel, UINT8 ubAimLocation, UINT8 ubTileSightLimit, INT8 bAware );
 INT32 SoldierToVirtualSoldierLineOfSightTest(const SOLDIERTYPE* pStartSoldier, INT16 sGridNo, INT8 bLevel, INT8 bStance, UINT8 ubTileSightLimit, INT8 bAware);
+
+struct VIRTUAL_SOLDIER_LOS_TEST
+{
+	INT16 sGridNo;
+	INT8  bLevel;
+	INT8  bStance;
+	UINT8 ubTileSightLimit;
+	INT8  bAware;
+};
+
+/* SoldierToVirtualSoldierLineOfSightTest() for many targets at once, the
+ * results are stored in piResults.  The setup which only depends on the
+ * looker is done once and targets out of sight range are culled before
+ * tracing; the results are the same as those of the single tests. */
+void SoldierToVirtualSoldierLineOfSightTests(const SOLDIERTYPE* pStartSoldier, const VIRTUAL_SOLDIER_LOS_TEST* pTests, size_t n, INT32* piResults);
+
+// Times the single and the batched line of sight tests around a soldier
+void BenchmarkLineOfSight(const SOLDIERTYPE*);
 UINT8 SoldierToSoldierBodyPartChanceToGetThrough(SOLDIERTYPE* pStartSoldier, const SOLDIERTYPE* pEndSoldier, UINT8 ubAimLocation);
 UINT8 AISoldierToSoldierChanceToGetThrough(SOLDIERTYPE* pStartSoldier, const SOLDIERTYPE* pEndSoldier);
 UINT8 AISoldierToLocationChanceToGetThrough( SOLDIERTYPE * pStartSoldier, INT16 sGridNo, INT8 bLevel, INT8 bCubeLevel );
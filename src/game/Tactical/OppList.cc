@@ -1089,6 +1089,10 @@ void TurnOffTeamsMuzzleFlashes( UINT8 ubTeam )
 }
 
 
+// The most DecideHearing() can add: experience 1, night ops 2 + 2 at night,
+// extended ear 6 and darkness 3
+#define MAX_HEARING_BONUS 14
+
 static INT8 DecideHearing(const SOLDIERTYPE* pSoldier)
 {
 	// calculate the hearing value for the merc...
@@ -1233,6 +1237,8 @@ static void ManLooksForOtherTeams(SOLDIERTYPE* pSoldier)
 	FOR_EACH_MERC(i)
 	{
 		SOLDIERTYPE* const pOpponent = *i;
+		// teammates are skipped without touching their records
+		if (GetSoldierHot(*pOpponent).bTeam == pSoldier->bTeam) continue;
 		if (IsSoldierValidForSightings(*pOpponent))
 		{
 			// and if he's on another team...
@@ -1960,6 +1966,8 @@ static void OtherTeamsLookForMan(SOLDIERTYPE* pOpponent)
 	FOR_EACH_MERC(i)
 	{
 		SOLDIERTYPE* const pSoldier = *i;
+		// teammates don't look, skip them without touching their records
+		if (GetSoldierHot(*pSoldier).bTeam == pOpponent->bTeam) continue;
 
 		// if this merc is active, in this sector, and well enough to look
 		if (IsSoldierValidForSightings(*pSoldier) && pSoldier->bLife >= OKLIFE  && (pSoldier->ubBodyType != LARVAE_MONSTER))
@@ -3793,6 +3801,17 @@ static UINT8 CalcEffVolume(SOLDIERTYPE const* const pSoldier, INT16 const sGridN
 		}
 	}
 
+	// calculate the distance (in adjusted pixels) between the source of the
+	// noise (gridno) and the location of the would-be listener (pSoldier->gridno)
+	iDistance = (INT32) PythSpacesAway( pSoldier->sGridNo, sGridNo );
+
+	// out of reach even with the best hearing and the roof amplifying the sound?
+	// Then don't bother looking at the listener's hearing and inventory
+	if ((INT32) ubBaseVolume + MAX_HEARING_BONUS + 5 - (iDistance - 1) <= 0)
+	{
+		return( 0 );
+	}
+
 	// adjust default noise volume by listener's hearing capability
 	iEffVolume = (INT32) ubBaseVolume + (INT32) DecideHearing( pSoldier );
 
@@ -3801,10 +3820,6 @@ static UINT8 CalcEffVolume(SOLDIERTYPE const* const pSoldier, INT16 const sGridN
 	iEffVolume -= pSoldier->bOppCnt;
 
 
-	// calculate the distance (in adjusted pixels) between the source of the
-	// noise (gridno) and the location of the would-be listener (pSoldier->gridno)
-	iDistance = (INT32) PythSpacesAway( pSoldier->sGridNo, sGridNo );
-
 	// effective volume fades over distance beyond 1 tile away
 	iEffVolume -= (iDistance - 1);
 
@@ -4762,8 +4777,14 @@ void CheckForAlertWhenEnemyDies(SOLDIERTYPE* pDyingSoldier)
 	INT8  bDir;
 	INT16 sDistAway, sDistVisible;
 
-	FOR_EACH_IN_TEAM(pSoldier, pDyingSoldier->bTeam)
+	// Nobody sees further than MaxDistanceVisible() plus the bonuses for roofs,
+	// goggles and night ops, or the range of a tank; a cow's smell carries
+	// further than all of those
+	INT16 const max_dist = MaxDistanceVisible() * COW_SMELL_STRENGTH / NORMAL_HUMAN_SMELL_STRENGTH;
+
+	ForEachTeamSoldierWithin(pDyingSoldier->bTeam, pDyingSoldier->sGridNo, max_dist, [&](SOLDIERTYPE& s)
 	{
+		SOLDIERTYPE* const pSoldier = &s;
 		if (IsSoldierValidForSightings(*pSoldier) && pSoldier != pDyingSoldier &&
 		    pSoldier->bLife >= OKLIFE && pSoldier->bAlertStatus < STATUS_RED)
 		{
@@ -4789,7 +4810,7 @@ void CheckForAlertWhenEnemyDies(SOLDIERTYPE* pDyingSoldier)
 				}
 			}
 		}
-	}
+	});
 }
 
 
@@ -102,6 +102,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <vector>
 
 #define RT_DELAY_BETWEEN_AI_HANDLING	50
 #define RT_AI_TIMESLICE			10
@@ -127,6 +128,17 @@ BOOLEAN gfSurrendered = FALSE;
 // Soldier List used for all soldier overhead interaction
 SOLDIERTYPE  Menptr[TOTAL_SOLDIERS];
 
+SOLDIERHOTTYPE gSoldierHot[TOTAL_SOLDIERS];
+
+// Per team lists of the soldiers in each cell.  The links hold soldier ID + 1,
+// so the zero initialised arrays are empty lists.
+static UINT16 guiCellHead[MAXTEAMS][SOLDIER_CELLS * SOLDIER_CELLS];
+static UINT16 guiCellNext[TOTAL_SOLDIERS];
+static UINT16 guiCellPrev[TOTAL_SOLDIERS];
+static INT16  gsSoldierCell[TOTAL_SOLDIERS]; // cell + 1, 0 if not in the index
+static INT8   gbSoldierCellTeam[TOTAL_SOLDIERS];
+static UINT8  gubNumSoldiersInCells[MAXTEAMS];
+
 SOLDIERTYPE* MercSlots[TOTAL_SOLDIERS];
 UINT32       guiNumMercSlots = 0;
 
@@ -340,6 +352,88 @@ BOOLEAN RemoveAwaySlot(SOLDIERTYPE* pSoldier)
 }
 
 
+static void UpdateSoldierCell(size_t const idx, SOLDIERHOTTYPE const& h)
+{
+	INT16 cell = 0;
+	if (h.bActive && h.bInSector && 0 <= h.bTeam && h.bTeam < MAXTEAMS &&
+		0 <= h.sGridNo && h.sGridNo < WORLD_MAX)
+	{
+		cell = h.sGridNo / WORLD_COLS / SOLDIER_CELL_SIZE * SOLDIER_CELLS +
+			h.sGridNo % WORLD_COLS / SOLDIER_CELL_SIZE + 1;
+	}
+	if (cell == gsSoldierCell[idx] && (cell == 0 || h.bTeam == gbSoldierCellTeam[idx])) return;
+
+	UINT16 const link = static_cast<UINT16>(idx + 1);
+	if (gsSoldierCell[idx] != 0)
+	{ // Unlink from the old cell
+		INT8   const team = gbSoldierCellTeam[idx];
+		UINT16 const next = guiCellNext[idx];
+		UINT16 const prev = guiCellPrev[idx];
+		if (prev != 0)
+		{
+			guiCellNext[prev - 1] = next;
+		}
+		else
+		{
+			guiCellHead[team][gsSoldierCell[idx] - 1] = next;
+		}
+		if (next != 0) guiCellPrev[next - 1] = prev;
+		--gubNumSoldiersInCells[team];
+	}
+
+	gsSoldierCell[idx] = cell;
+	if (cell == 0) return;
+
+	UINT16& head = guiCellHead[h.bTeam][cell - 1];
+	guiCellPrev[idx]       = 0;
+	guiCellNext[idx]       = head;
+	if (head != 0) guiCellPrev[head - 1] = link;
+	head                   = link;
+	gbSoldierCellTeam[idx] = h.bTeam;
+	++gubNumSoldiersInCells[h.bTeam];
+}
+
+
+void UpdateSoldierHotState(SOLDIERTYPE const& s)
+{
+	if (&s < Menptr || Menptr + lengthof(Menptr) <= &s) return;
+
+	size_t const idx = &s - Menptr;
+	SOLDIERHOTTYPE& h = gSoldierHot[idx];
+	h.sGridNo   = s.sGridNo;
+	h.bLevel    = s.bLevel;
+	h.bTeam     = s.bTeam;
+	h.bSide     = s.bSide;
+	h.bNeutral  = s.bNeutral;
+	h.bActive   = s.bActive;
+	h.bInSector = s.bInSector;
+	UpdateSoldierCell(idx, h);
+}
+
+
+SOLDIERTYPE* FirstSoldierInCell(INT8 const team, INT16 const cell_x, INT16 const cell_y)
+{
+	if (team < 0 || MAXTEAMS <= team) return NULL;
+	if (cell_x < 0 || SOLDIER_CELLS <= cell_x) return NULL;
+	if (cell_y < 0 || SOLDIER_CELLS <= cell_y) return NULL;
+	UINT16 const link = guiCellHead[team][cell_y * SOLDIER_CELLS + cell_x];
+	return link != 0 ? &Menptr[link - 1] : NULL;
+}
+
+
+SOLDIERTYPE* NextSoldierInCell(SOLDIERTYPE const& s)
+{
+	UINT16 const link = guiCellNext[&s - Menptr];
+	return link != 0 ? &Menptr[link - 1] : NULL;
+}
+
+
+UINT8 NumSoldiersInCells(INT8 const team)
+{
+	return 0 <= team && team < MAXTEAMS ? gubNumSoldiersInCells[team] : 0;
+}
+
+
 INT32 MoveSoldierFromMercToAwaySlot(SOLDIERTYPE* pSoldier)
 {
 	BOOLEAN fRet = RemoveMercSlot(pSoldier);
@@ -352,6 +446,7 @@ INT32 MoveSoldierFromMercToAwaySlot(SOLDIERTYPE* pSoldier)
 
 	pSoldier->bInSector      = FALSE;
 	pSoldier->uiStatusFlags |= SOLDIER_OFF_MAP;
+	UpdateSoldierHotState(*pSoldier);
 	return AddAwaySlot(pSoldier);
 }
 
@@ -364,6 +459,7 @@ void MoveSoldierFromAwayToMercSlot(SOLDIERTYPE* const pSoldier)
 
 	pSoldier->bInSector      = TRUE;
 	pSoldier->uiStatusFlags &= ~SOLDIER_OFF_MAP;
+	UpdateSoldierHotState(*pSoldier);
 	AddMercSlot(pSoldier);
 }
 
@@ -409,6 +505,7 @@ void InitOverhead()
 	std::fill(std::begin(MercSlots), std::end(MercSlots), nullptr);
 	std::fill(std::begin(AwaySlots), std::end(AwaySlots), nullptr);
 	std::fill(std::begin(Menptr), std::end(Menptr), SOLDIERTYPE{});
+	for (SOLDIERTYPE const& s : Menptr) UpdateSoldierHotState(s);
 
 	TacticalStatusType& t = gTacticalStatus;
 	t = TacticalStatusType{};
@@ -457,6 +554,15 @@ void ShutdownOverhead(void)
 }
 
 
+// In realtime HandleSoldierAI() does nothing for a soldier until his AI timer
+// has run out, unless he is handled every frame.  Soldiers which are not due
+// yet are passed over, so idle ones do not take turns in the round robin.
+static bool IsRealtimeAIDue(SOLDIERTYPE const& s)
+{
+	return s.fAIFlags & AI_HANDLE_EVERY_FRAME || TIMECOUNTERELAPSED(s.AICounter);
+}
+
+
 static BOOLEAN NextAIToHandle(UINT32 uiCurrAISlot)
 {
 	UINT32 cnt;
@@ -475,7 +581,8 @@ static BOOLEAN NextAIToHandle(UINT32 uiCurrAISlot)
 	for (; cnt < guiNumMercSlots; ++cnt)
 	{
 		if (MercSlots[cnt] &&
-				(MercSlots[cnt]->bTeam != OUR_TEAM || MercSlots[cnt]->uiStatusFlags & SOLDIER_PCUNDERAICONTROL))
+				(GetSoldierHot(*MercSlots[cnt]).bTeam != OUR_TEAM || MercSlots[cnt]->uiStatusFlags & SOLDIER_PCUNDERAICONTROL) &&
+				IsRealtimeAIDue(*MercSlots[cnt]))
 		{
 			// aha! found an AI guy!
 			guiAISlotToHandle = cnt;
@@ -504,7 +611,7 @@ static BOOLEAN NextAIToHandle(UINT32 uiCurrAISlot)
 
 		for (; cnt < guiNumAwaySlots; ++cnt)
 		{
-			if (AwaySlots[cnt] && AwaySlots[cnt]->bTeam != OUR_TEAM)
+			if (AwaySlots[cnt] && AwaySlots[cnt]->bTeam != OUR_TEAM && IsRealtimeAIDue(*AwaySlots[cnt]))
 			{
 				// aha! found an AI guy!
 				guiAIAwaySlotToHandle = cnt;
@@ -2641,6 +2748,7 @@ void CheckForPotentialAddToBattleIncrement(SOLDIERTYPE* pSoldier)
 void SetSoldierNonNeutral(SOLDIERTYPE* pSoldier)
 {
 	pSoldier->bNeutral = FALSE;
+	UpdateSoldierHotState(*pSoldier);
 	if (gTacticalStatus.bBoxingState == NOT_BOXING)
 	{
 		// Special code for strategic implications
@@ -2653,6 +2761,7 @@ void SetSoldierNonNeutral(SOLDIERTYPE* pSoldier)
 void SetSoldierNeutral(SOLDIERTYPE* pSoldier)
 {
 	pSoldier->bNeutral = TRUE;
+	UpdateSoldierHotState(*pSoldier);
 	if (gTacticalStatus.bBoxingState == NOT_BOXING)
 	{
 		// Special code for strategic implications
@@ -2714,6 +2823,7 @@ void MakeCivHostile(SOLDIERTYPE* pSoldier, INT8 bNewSide)
 		// change to enemy team
 		SetSoldierNonNeutral(pSoldier);
 		pSoldier->bSide = bNewSide;
+		UpdateSoldierHotState(*pSoldier);
 		pSoldier = ChangeSoldierTeam(pSoldier, ENEMY_TEAM);
 	}
 	else
@@ -2734,6 +2844,7 @@ void MakeCivHostile(SOLDIERTYPE* pSoldier, INT8 bNewSide)
 		}
 		if (pSoldier->ubProfile == BILLY) pSoldier->bOrders = FARPATROL;
 		if (bNewSide != -1) pSoldier->bSide = bNewSide;
+		UpdateSoldierHotState(*pSoldier);
 		if (pSoldier->bNeutral)
 		{
 			SetSoldierNonNeutral(pSoldier);
@@ -5878,6 +5989,7 @@ void RemoveSoldierFromTacticalSector(SOLDIERTYPE& s)
 	RemoveMercSlot(&s);
 
 	s.bInSector = FALSE;
+	UpdateSoldierHotState(s);
 
 	// Select next avialiable guy....
 	if (guiCurrentScreen == GAME_SCREEN)
@@ -6009,6 +6121,7 @@ void DoPOWPathChecks(void)
 		// free! free!
 		// put them on any available squad
 		s->bNeutral = FALSE;
+		UpdateSoldierHotState(*s);
 		AddCharacterToAnySquad(s);
 		DoMercBattleSound(s, BATTLE_SOUND_COOL1);
 	}
@@ -6203,4 +6316,42 @@ TEST(Overhead, asserts)
 	EXPECT_EQ(lengthof(g_default_team_info), static_cast<size_t>(MAXTEAMS));
 }
 
+TEST(Overhead, forEachTeamSoldierWithin)
+{
+	SOLDIERTYPE& near = Menptr[20];
+	SOLDIERTYPE& far  = Menptr[21];
+	SOLDIERTYPE const saved_near = near;
+	SOLDIERTYPE const saved_far  = far;
+	INT16 const centre = 80 * WORLD_COLS + 80;
+
+	for (SOLDIERTYPE* const s : { &near, &far })
+	{
+		s->bActive   = TRUE;
+		s->bInSector = TRUE;
+		s->bTeam     = ENEMY_TEAM;
+	}
+	near.sGridNo = centre + 10 * WORLD_COLS - 10;
+	far.sGridNo  = centre + 40;
+	UpdateSoldierHotState(near);
+	UpdateSoldierHotState(far);
+
+	std::vector<SOLDIERTYPE*> seen;
+	ForEachTeamSoldierWithin(ENEMY_TEAM, centre, 10, [&](SOLDIERTYPE& s) { seen.push_back(&s); });
+	EXPECT_EQ(seen, std::vector<SOLDIERTYPE*>{ &near });
+
+	seen.clear();
+	ForEachTeamSoldierWithin(ENEMY_TEAM, centre, 40, [&](SOLDIERTYPE& s) { seen.push_back(&s); });
+	EXPECT_EQ(seen.size(), static_cast<size_t>(2));
+
+	seen.clear();
+	ForEachTeamSoldierWithin(OUR_TEAM,   centre, 40, [&](SOLDIERTYPE& s) { seen.push_back(&s); });
+	ForEachTeamSoldierWithin(ENEMY_TEAM, NOWHERE, 40, [&](SOLDIERTYPE& s) { seen.push_back(&s); });
+	EXPECT_TRUE(seen.empty());
+
+	near = saved_near;
+	far  = saved_far;
+	UpdateSoldierHotState(near);
+	UpdateSoldierHotState(far);
+}
+
 #endif
@@ -3,6 +3,9 @@
 
 #include "Debug.h"
 #include "Soldier_Control.h"
+#include "WorldDef.h"
+
+#include <algorithm>
 
 
 #define MAX_REALTIME_SPEED_VAL		10
@@ -141,6 +144,124 @@ static inline SOLDIERTYPE& GetMan(UINT const idx)
 	return Menptr[idx];
 }
 
+/* The fields the per frame overhead, sight and AI scans filter on, packed into
+ * a small array parallel to Menptr, so those scans can skip soldiers without
+ * pulling their whole record into the cache.  SOLDIERTYPE stays authoritative;
+ * whatever changes one of these fields calls UpdateSoldierHotState() after. */
+struct SOLDIERHOTTYPE
+{
+	INT16   sGridNo;
+	INT8    bLevel;
+	INT8    bTeam;
+	INT8    bSide;
+	BOOLEAN bNeutral;
+	BOOLEAN bActive;
+	BOOLEAN bInSector;
+};
+
+extern SOLDIERHOTTYPE gSoldierHot[TOTAL_SOLDIERS];
+
+// Does nothing for soldiers which are not in Menptr, e.g. the dummies used for path tests
+void UpdateSoldierHotState(SOLDIERTYPE const&);
+
+static inline SOLDIERHOTTYPE const& GetSoldierHot(SOLDIERTYPE const& s)
+{
+	// computed from the address, so the soldier record itself is not touched
+	size_t const idx = &s - Menptr;
+	Assert(idx < lengthof(Menptr));
+	return gSoldierHot[idx];
+}
+
+/* Spatial index of the soldiers in the sector, kept along with the hot state:
+ * per team, the map is split into square cells of SOLDIER_CELL_SIZE tiles and
+ * each cell lists the active soldiers standing in it.  Proximity queries walk
+ * the cells around a gridno instead of the whole team. */
+#define SOLDIER_CELL_SIZE 8
+#define SOLDIER_CELLS     (WORLD_COLS / SOLDIER_CELL_SIZE) // per row and column
+
+// First soldier of the team in the cell, NULL if there is none
+SOLDIERTYPE* FirstSoldierInCell(INT8 team, INT16 cell_x, INT16 cell_y);
+SOLDIERTYPE* NextSoldierInCell(SOLDIERTYPE const&);
+UINT8        NumSoldiersInCells(INT8 team);
+
+/* Returns the soldier of the team with the lowest score(s), NULL if score() is
+ * negative for all of them.  score() must never be less than the SpacesAway()
+ * from gridno, so the cells further out can be skipped once they cannot hold a
+ * better soldier.  Ties go to the lower soldier ID, like a scan of the team. */
+template<typename F>
+SOLDIERTYPE* FindClosestTeamSoldier(INT8 const team, INT16 const gridno, F&& score, INT16* const best_score = NULL)
+{
+	SOLDIERTYPE* best   = NULL;
+	INT16        best_s = 0;
+	if (NumSoldiersInCells(team) != 0)
+	{
+		// Without a valid gridno there is no bound, so every cell is searched
+		bool  const on_map = 0 <= gridno && gridno < WORLD_MAX;
+		INT16 const cx     = on_map ? gridno % WORLD_COLS / SOLDIER_CELL_SIZE : 0;
+		INT16 const cy     = on_map ? gridno / WORLD_COLS / SOLDIER_CELL_SIZE : 0;
+		for (INT16 r = 0; r != SOLDIER_CELLS; ++r)
+		{
+			// Everybody in ring r is more than (r - 1) * SOLDIER_CELL_SIZE tiles away
+			if (best && on_map && best_s <= (r - 1) * SOLDIER_CELL_SIZE) break;
+			for (INT16 y = cy - r; y <= cy + r; ++y)
+			{
+				INT16 const step = y == cy - r || y == cy + r ? 1 : 2 * r;
+				for (INT16 x = cx - r; x <= cx + r; x += step)
+				{
+					for (SOLDIERTYPE* s = FirstSoldierInCell(team, x, y); s; s = NextSoldierInCell(*s))
+					{
+						INT16 const sc = score(*s);
+						if (sc < 0) continue;
+						if (best && (sc > best_s || (sc == best_s && s->ubID > best->ubID))) continue;
+						best   = s;
+						best_s = sc;
+					}
+				}
+			}
+		}
+	}
+	if (best_score) *best_score = best_s;
+	return best;
+}
+
+/* Calls fn(s) for every soldier of the team in the cells which overlap the
+ * square of the given radius around gridno.  Those cells may also hold soldiers
+ * a bit further away, so fn() still has to test the exact distance.  The order
+ * is by cell, not by soldier ID. */
+template<typename F>
+void ForEachTeamSoldierWithin(INT8 const team, INT16 const gridno, INT16 const radius, F&& fn)
+{
+	if (NumSoldiersInCells(team) == 0) return;
+	if (gridno < 0 || WORLD_MAX <= gridno) return;
+
+	INT16 const x  = gridno % WORLD_COLS;
+	INT16 const y  = gridno / WORLD_COLS;
+	INT16 const x0 = std::max(x - radius, 0)              / SOLDIER_CELL_SIZE;
+	INT16 const y0 = std::max(y - radius, 0)              / SOLDIER_CELL_SIZE;
+	INT16 const x1 = std::min(x + radius, WORLD_COLS - 1) / SOLDIER_CELL_SIZE;
+	INT16 const y1 = std::min(y + radius, WORLD_ROWS - 1) / SOLDIER_CELL_SIZE;
+	for (INT16 cy = y0; cy <= y1; ++cy)
+	{
+		for (INT16 cx = x0; cx <= x1; ++cx)
+		{
+			SOLDIERTYPE* next;
+			for (SOLDIERTYPE* s = FirstSoldierInCell(team, cx, cy); s; s = next)
+			{
+				// fetched first, fn() may move the soldier to another cell
+				next = NextSoldierInCell(*s);
+				fn(*s);
+			}
+		}
+	}
+}
+
+// True if CONSIDERED_NEUTRAL(me, them) or both are on the same side, as far as
+// the hot state tells; false means the full test has to be done
+static inline bool IsHotFriendOrNeutral(SOLDIERTYPE const& me, SOLDIERHOTTYPE const& them)
+{
+	return them.bSide == me.bSide || (them.bNeutral && me.bTeam != CREATURE_TEAM);
+}
+
 static inline SoldierID Soldier2ID(const SOLDIERTYPE* const s)
 {
 	return s != NULL ? s->ubID : NOBODY;
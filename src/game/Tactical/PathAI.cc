@@ -48,6 +48,7 @@ static BOOLEAN gfDrawPathPoints = FALSE;
 #include "Logger.h"
 
 #include <algorithm>
+#include <vector>
 
 BOOLEAN gfPlotPathToExitGrid = FALSE;
 BOOLEAN gfRecalculatingExistingPathCost = FALSE;
@@ -1895,8 +1896,47 @@ ENDOFLOOP:
 	return(0);
 }
 
-void GlobalReachableTest( INT16 sStartGridNo )
+// Connected components of the ground level as the global reachable tests see
+// them.  Each tile carries the label of its component, a component is computed
+// by a single flood fill the first time one of its tiles is used as a start
+// and dropped as soon as the movement costs of one of its tiles or their
+// neighbours are recompiled or a door among them is locked or unlocked.  Label
+// 0 means "no component".
+static std::vector<UINT16> gusReachableComponent;
+static std::vector<bool>   gfReachableComponentValid;
+
+
+void ResetReachableComponents()
+{
+	gusReachableComponent.assign(WORLD_MAX, 0);
+	gfReachableComponentValid.assign(1, false);
+}
+
+
+void InvalidateReachableComponentsAt(INT16 const sGridNo)
+{
+	if (gusReachableComponent.size() != WORLD_MAX) return;
+
+	for (UINT8 dir = 0; dir <= NUM_WORLD_DIRECTIONS; ++dir)
+	{
+		// the last round checks the tile itself
+		INT16 const grid_no = dir == NUM_WORLD_DIRECTIONS ? sGridNo : NewGridNo(sGridNo, DirectionInc(dir));
+		gfReachableComponentValid[gusReachableComponent[grid_no]] = false;
+	}
+}
+
+
+static UINT16 GetReachableComponent(INT16 const sStartGridNo)
 {
+	if (gusReachableComponent.size() != WORLD_MAX) ResetReachableComponents();
+
+	UINT16 const current = gusReachableComponent[sStartGridNo];
+	if (gfReachableComponentValid[current]) return current;
+
+	if (gfReachableComponentValid.size() > UINT16_MAX) ResetReachableComponents();
+	UINT16 const label = static_cast<UINT16>(gfReachableComponentValid.size());
+	gfReachableComponentValid.push_back(true);
+
 	SOLDIERTYPE s;
 
 	s = SOLDIERTYPE{};
@@ -1913,6 +1953,42 @@ void GlobalReachableTest( INT16 sStartGridNo )
 	ReconfigurePathAI( ABSMAX_SKIPLIST_LEVEL, ABSMAX_TRAIL_TREE, ABSMAX_PATHQ );
 	FindBestPath( &s, NOWHERE, 0, WALKING, COPYREACHABLE, PATH_THROUGH_PEOPLE );
 	RestorePathAIToDefaults();
+
+	for (INT16 grid_no = 0; grid_no != WORLD_MAX; ++grid_no)
+	{
+		if (!(gpWorldLevelData[grid_no].uiFlags & MAPELEMENT_REACHABLE)) continue;
+
+		// An overlapping component is out of date, recompute it when it is used
+		UINT16& component = gusReachableComponent[grid_no];
+		if (component != label) gfReachableComponentValid[component] = false;
+		component = label;
+	}
+	return label;
+}
+
+
+static void SetReachableFlags(UINT16 const label1, UINT16 const label2)
+{
+	for (INT16 grid_no = 0; grid_no != WORLD_MAX; ++grid_no)
+	{
+		UINT16 const component = gusReachableComponent[grid_no];
+		UINT16&      flags     = gpWorldLevelData[grid_no].uiFlags;
+		if (component != 0 && (component == label1 || component == label2))
+		{
+			flags |= MAPELEMENT_REACHABLE;
+		}
+		else
+		{
+			flags &= ~MAPELEMENT_REACHABLE;
+		}
+	}
+}
+
+
+void GlobalReachableTest( INT16 sStartGridNo )
+{
+	UINT16 const label = GetReachableComponent(sStartGridNo);
+	SetReachableFlags(label, label);
 }
 
 void LocalReachableTest( INT16 sStartGridNo, INT8 bRadius )
@@ -1959,27 +2035,9 @@ void LocalReachableTest( INT16 sStartGridNo, INT8 bRadius )
 
 void GlobalItemsReachableTest( INT16 sStartGridNo1, INT16 sStartGridNo2 )
 {
-	SOLDIERTYPE s;
-
-	s = SOLDIERTYPE{};
-	s.sGridNo = sStartGridNo1;
-	s.bLevel = 0;
-	s.bTeam = 1;
-
-	//reset the flag for gridno's
-	FOR_EACH_WORLD_TILE(i)
-	{
-		i->uiFlags &= ~MAPELEMENT_REACHABLE;
-	}
-
-	ReconfigurePathAI( ABSMAX_SKIPLIST_LEVEL, ABSMAX_TRAIL_TREE, ABSMAX_PATHQ );
-	FindBestPath( &s, NOWHERE, 0, WALKING, COPYREACHABLE, PATH_THROUGH_PEOPLE );
-	if ( sStartGridNo2 != NOWHERE )
-	{
-		s.sGridNo = sStartGridNo2;
-		FindBestPath( &s, NOWHERE, 0, WALKING, COPYREACHABLE, PATH_THROUGH_PEOPLE );
-	}
-	RestorePathAIToDefaults();
+	UINT16 const label1 = GetReachableComponent(sStartGridNo1);
+	UINT16 const label2 = sStartGridNo2 != NOWHERE ? GetReachableComponent(sStartGridNo2) : label1;
+	SetReachableFlags(label1, label2);
 }
 
 void RoofReachableTest( INT16 sStartGridNo, UINT8 ubBuildingID )
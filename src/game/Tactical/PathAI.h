@@ -25,6 +25,12 @@ void GlobalItemsReachableTest( INT16 sStartGridNo1, INT16 sStartGridNo2 );
 void RoofReachableTest( INT16 sStartGridNo, UINT8 ubBuildingID );
 void LocalReachableTest( INT16 sStartGridNo, INT8 bRadius );
 
+// The global reachable tests remember the components of the ground level they
+// flood filled.  Both are called by the movement cost compilation and by the
+// door table whenever a lock changes.
+void ResetReachableComponents();
+void InvalidateReachableComponentsAt(INT16 sGridNo);
+
 UINT8 DoorTravelCost(const SOLDIERTYPE* pSoldier, INT32 iGridNo, UINT8 ubMovementCost, BOOLEAN fReturnPerceivedValue, INT32* piDoorGridNo);
 UINT8 InternalDoorTravelCost(const SOLDIERTYPE* pSoldier, INT32 iGridNo, UINT8 ubMovementCost, BOOLEAN fReturnPerceivedValue, INT32* piDoorGridNo, BOOLEAN fReturnDoorCost);
 BOOLEAN IsDoorObstacleIfClosed(UINT8 ubMovementCost, INT32 iGridNo, INT32* iDoorGridNo, INT32* iDoorGridNo2);
@@ -0,0 +1,88 @@
+#include "gtest/gtest.h"
+
+#include "Keys.h"
+#include "PathAI.h"
+#include "RenderWorld.h"
+#include "Structure_Internals.h"
+#include "WorldDef.h"
+
+#include <algorithm>
+#include <vector>
+
+
+static bool Reachable(INT16 const sFrom, INT16 const sTo)
+{
+	GlobalReachableTest(sFrom);
+	return (gpWorldLevelData[sTo].uiFlags & MAPELEMENT_REACHABLE) != 0;
+}
+
+
+// Two rooms joined by a single door.  The global reachable test remembers the
+// component it flood filled, so locking the door in between two tests has to
+// split it and unlocking the door has to join it again.
+TEST(PathAI, reachableComponentsFollowDoorLocks)
+{
+	UINT8* const costs = &gubWorldMovementCosts[0][0][0];
+	size_t const n_costs = sizeof(gubWorldMovementCosts);
+	std::vector<UINT8> const saved_costs(costs, costs + n_costs);
+	INT16 const saved_left   = gsLeftX;
+	INT16 const saved_top    = gsTopY;
+	INT16 const saved_right  = gsRightX;
+	INT16 const saved_bottom = gsBottomY;
+
+	// Everything is visible and everything but the rooms is blocked
+	gsLeftX   = -16000;
+	gsTopY    = -16000;
+	gsRightX  =  16000;
+	gsBottomY =  16000;
+	std::fill_n(costs, n_costs, TRAVELCOST_OBSTACLE);
+	for (INT16 y = 79; y <= 81; ++y)
+	{
+		for (INT16 x = 77; x <= 83; ++x)
+		{
+			if (x == 80) continue;
+			std::fill_n(gubWorldMovementCosts[y * WORLD_COLS + x][0], MAXDIR * 2, TRAVELCOST_FLAT);
+		}
+	}
+
+	INT16 const door_gridno = 80 * WORLD_COLS + 80;
+	INT16 const west        = 80 * WORLD_COLS + 78;
+	INT16 const east        = 80 * WORLD_COLS + 82;
+	std::fill_n(gubWorldMovementCosts[door_gridno][0], MAXDIR * 2, TRAVELCOST_DOOR_CLOSED_HERE);
+
+	STRUCTURE door_structure{};
+	door_structure.sGridNo = door_gridno;
+	door_structure.fFlags  = STRUCTURE_DOOR;
+	STRUCTURE* const saved_head = gpWorldLevelData[door_gridno].pStructureHead;
+	gpWorldLevelData[door_gridno].pStructureHead = &door_structure;
+
+	DOOR door{};
+	door.sGridNo = door_gridno;
+	AddDoorInfoToTable(&door);
+
+	InitPathAI();
+	ResetReachableComponents();
+
+	EXPECT_TRUE(Reachable(west, east));
+
+	FindDoorInfoAtGridNo(door_gridno)->setLocked(true);
+	EXPECT_FALSE(Reachable(west, east));
+	EXPECT_FALSE(Reachable(east, west));
+
+	FindDoorInfoAtGridNo(door_gridno)->setLocked(false);
+	EXPECT_TRUE(Reachable(east, west));
+
+	ShutDownPathAI();
+	RemoveDoorInfoFromTable(door_gridno);
+	ResetReachableComponents();
+	FOR_EACH_WORLD_TILE(i)
+	{
+		i->uiFlags &= ~MAPELEMENT_REACHABLE;
+	}
+	gpWorldLevelData[door_gridno].pStructureHead = saved_head;
+	std::copy(saved_costs.begin(), saved_costs.end(), costs);
+	gsLeftX   = saved_left;
+	gsTopY    = saved_top;
+	gsRightX  = saved_right;
+	gsBottomY = saved_bottom;
+}
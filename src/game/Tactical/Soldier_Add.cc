@@ -876,12 +876,14 @@ static void InternalAddSoldierToSector(SOLDIERTYPE* const s, BOOLEAN calculate_d
 		AddAwaySlot(s);
 		// Guy is NOT "in sector"
 		s->bInSector = FALSE;
+		UpdateSoldierHotState(*s);
 	}
 	else
 	{
 		AddMercSlot(s);
 		// Add guy to sector flag
 		s->bInSector = TRUE;
+		UpdateSoldierHotState(*s);
 	}
 
 	// If a driver or passenger - stop here!
@@ -554,6 +554,8 @@ void	DoNinjaAttack( SOLDIERTYPE *pSoldier )
 void CreateSoldierCommon(SOLDIERTYPE& s)
 try
 {
+	UpdateSoldierHotState(s);
+
 	//if we are loading a saved game, we DO NOT want to reset the opplist,
 	//look for enemies, or say a dying commnet
 	if (!(gTacticalStatus.uiFlags & LOADING_SAVED_GAME))
@@ -684,6 +686,7 @@ void DeleteSoldier(SOLDIERTYPE& s)
 	if (!RemoveMercSlot(&s)) RemoveAwaySlot(&s);
 
 	s.bActive = FALSE;
+	UpdateSoldierHotState(s);
 }
 
 
@@ -1793,6 +1796,7 @@ static void InternalRemoveSoldierFromGridNo(SOLDIERTYPE& s, BOOLEAN const force)
 	UnMarkMovementReserved(s);
 	HandleCrowShadowRemoveGridNo(s);
 	s.sGridNo = NOWHERE;
+	UpdateSoldierHotState(s);
 }
 
 
@@ -1878,6 +1882,7 @@ void SetSoldierHeight(SOLDIERTYPE* const s, FLOAT const new_height)
 	{
 		s->bLevel = FIRST_LEVEL;
 	}
+	UpdateSoldierHotState(*s);
 }
 
 
@@ -1918,6 +1923,7 @@ static void SetSoldierGridNo(SOLDIERTYPE& s, GridNo new_grid_no, BOOLEAN const f
 	}
 
 	s.sGridNo = new_grid_no;
+	UpdateSoldierHotState(s);
 
 	// Check if our new gridno is valid, if not do not set!
 	if (!GridNoOnVisibleWorldTile(new_grid_no)) return;
@@ -3474,12 +3480,14 @@ BOOLEAN EVENT_InternalGetNewSoldierPath( SOLDIERTYPE *pSoldier, UINT16 sDestGrid
 
 		sMercGridNo = pSoldier->sGridNo;
 		pSoldier->sGridNo = pSoldier->sDestination;
+		UpdateSoldierHotState(*pSoldier);
 
 		// Check if path is good before copying it into guy's path...
 		if ( FindBestPath( pSoldier, sDestGridNo, pSoldier->bLevel, pSoldier->usUIMovementMode, NO_COPYROUTE, fFlags ) == 0 )
 		{
 			// Set to old....
 			pSoldier->sGridNo = sMercGridNo;
+			UpdateSoldierHotState(*pSoldier);
 
 			return( FALSE );
 		}
@@ -3487,6 +3495,7 @@ BOOLEAN EVENT_InternalGetNewSoldierPath( SOLDIERTYPE *pSoldier, UINT16 sDestGrid
 		uiDist =  FindBestPath( pSoldier, sDestGridNo, pSoldier->bLevel, pSoldier->usUIMovementMode, COPYROUTE, fFlags );
 
 		pSoldier->sGridNo = sMercGridNo;
+		UpdateSoldierHotState(*pSoldier);
 		pSoldier->sFinalDestination = sDestGridNo;
 
 		if ( uiDist > 0 )
@@ -4639,6 +4648,7 @@ static UINT16* CreateEnemyGreyGlow16BPPPalette(const SGPPaletteEntry* pPalette,
 void CreateSoldierPalettes(SOLDIERTYPE& s)
 {
 	// --- TAKE FROM CURRENT ANIMATION HVOBJECT!
+	CompleteAnimationSurface(s.ubID, s.usAnimSurface, s.usAnimState);
 	UINT16 const anim_surface = GetSoldierAnimationSurface(&s);
 	if (anim_surface == INVALID_ANIMATION_SURFACE)
 	{
@@ -4656,6 +4666,8 @@ void CreateSoldierPalettes(SOLDIERTYPE& s)
 		UINT16 const palette_anim_surface = LoadSoldierAnimationSurface(s, STANDING);
 		if (palette_anim_surface != INVALID_ANIMATION_SURFACE)
 		{
+			CompleteAnimationSurface(s.ubID, palette_anim_surface, STANDING);
+
 			// Use palette from HVOBJECT, then use substitution for pants, etc
 			memcpy(tmp_pal, gAnimSurfaceDatabase[palette_anim_surface].hVideoObject->Palette(), sizeof(*tmp_pal) * 256);
 
@@ -951,6 +951,7 @@ static void InitSoldierStruct(SOLDIERTYPE& s)
 	s.uiXRayActivatedTime       = 0;
 	s.bBulletsLeft              = 0;
 	s.bVehicleUnderRepairID     = -1;
+	UpdateSoldierHotState(s);
 }
 
 
@@ -1728,6 +1729,7 @@ try
 			{
 				//reserve this soldier
 				s->sGridNo = NOWHERE;
+				UpdateSoldierHotState(*s);
 
 				//Allocate and copy the soldier
 				SOLDIERTYPE* const pSoldier = new SOLDIERTYPE{};
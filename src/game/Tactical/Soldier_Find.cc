@@ -165,7 +165,7 @@ SOLDIERTYPE* FindSoldier(GridNo const gridno, UINT32 flags)
 			if (s.uiStatusFlags & SOLDIER_VEHICLE)
 			{
 				UINT16 const anim_surface = GetSoldierAnimationSurface(&s);
-				if (anim_surface != INVALID_ANIMATION_SURFACE)
+				if (anim_surface != INVALID_ANIMATION_SURFACE && gAnimSurfaceDatabase[anim_surface].hVideoObject)
 				{
 					INT32 const merc_screen_x =   screen_x - soldier_rect.iLeft;
 					INT32 const merc_screen_y = -(screen_y - soldier_rect.iBottom);
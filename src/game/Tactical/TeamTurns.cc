@@ -30,6 +30,7 @@
 #include "SkillCheck.h"
 #include "AIInternals.h"
 #include "AIList.h"
+#include "CoverField.h"
 #include "RenderWorld.h"
 #include "Rotting_Corpses.h"
 #include "Squads.h"
@@ -319,6 +320,9 @@ void BeginTeamTurn( UINT8 ubTeam )
 
 		BeginLoggingForBleedMeToos( TRUE );
 
+		// whatever the last team saw and did, cover data is recalculated
+		InvalidateCoverField();
+
 		// decay team's public opplist
 		DecayPublicOpplist( ubTeam );
 
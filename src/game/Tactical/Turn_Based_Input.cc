@@ -37,6 +37,7 @@
 #include "Soldier_Add.h"
 #include "Dialogue_Control.h"
 #include "Interface_Dialogue.h"
+#include "LOS.h"
 #include "OppList.h"
 #include "MessageBoxScreen.h"
 #include "GameLoop.h"
@@ -2000,6 +2001,7 @@ static void HandleModAltCheats(UINT32 const key, UIEventKind * const new_event)
 			// Next hit by anybody does 100 damage.
 			gfNextShotKills = !gfNextShotKills;
 			break;
+		case '9': BenchmarkLineOfSight(GetSelectedMan()); break;
 
 		case 'b': *new_event = I_NEW_BADMERC;   break;
 		case 'c': CreateNextCivType();          break;
@@ -19,7 +19,10 @@
 #include "WeaponModels.h"
 
 #include <algorithm>
+#include <functional>
+#include <queue>
 #include <stdexcept>
+#include <unordered_map>
 #include <vector>
 
 //Global dynamic array of all of the items in a loaded map.
@@ -27,21 +30,29 @@ std::vector<WORLDITEM> gWorldItems;
 
 std::vector<WORLDBOMB> gWorldBombs;
 
+// Unused slots of gWorldItems and gWorldBombs.  The lowest one is reused first,
+// like the linear searches for a free slot did.
+typedef std::priority_queue<INT32, std::vector<INT32>, std::greater<INT32>> FreeSlots;
+static FreeSlots gFreeWorldItemSlots;
+static FreeSlots gFreeWorldBombSlots;
+
+// Bomb indices by gridno, each list in ascending order.  Items never move, so
+// the gridno of a bomb stays the same as long as it exists.
+static std::unordered_map<INT16, std::vector<UINT32>> gWorldBombsByGridNo;
+
 
 static INT32 GetFreeWorldBombIndex(void)
 {
-	INT32 idx;
-
-	Assert(gWorldBombs.size() <= INT32_MAX);
-	for (idx = 0; idx < static_cast<INT32>(gWorldBombs.size()); idx++)
+	if (!gFreeWorldBombSlots.empty())
 	{
-		if (!gWorldBombs[idx].fExists) return idx;
+		INT32 const idx = gFreeWorldBombSlots.top();
+		gFreeWorldBombSlots.pop();
+		return idx;
 	}
 
+	Assert(gWorldBombs.size() < INT32_MAX);
 	gWorldBombs.push_back(WORLDBOMB{});
-
-	// Return uiCount.....
-	return( idx );
+	return static_cast<INT32>(gWorldBombs.size() - 1);
 }
 
 
@@ -55,6 +66,9 @@ static INT32 AddBombToWorld(INT32 iItemIndex)
 	gWorldBombs[ iBombIndex ].fExists = TRUE;
 	gWorldBombs[ iBombIndex ].iItemIndex = iItemIndex;
 
+	std::vector<UINT32>& bombs = gWorldBombsByGridNo[GetWorldItem(iItemIndex).sGridNo];
+	bombs.insert(std::upper_bound(bombs.begin(), bombs.end(), iBombIndex), iBombIndex);
+
 	return ( iBombIndex );
 }
 
@@ -63,22 +77,40 @@ static void RemoveBombFromWorldByItemIndex(INT32 iItemIndex)
 {
 	// Find the world bomb which corresponds with a particular world item, then
 	// remove the world bomb from the table.
-	FOR_EACH_WORLD_BOMB(wb)
+	INT16 const sGridNo = GetWorldItem(iItemIndex).sGridNo;
+	auto const i = gWorldBombsByGridNo.find(sGridNo);
+	if (i == gWorldBombsByGridNo.end()) return;
+
+	std::vector<UINT32>& bombs = i->second;
+	for (auto b = bombs.begin(); b != bombs.end(); ++b)
 	{
+		WORLDBOMB& wb = gWorldBombs[*b];
 		if (wb.iItemIndex != iItemIndex) continue;
 
 		wb.fExists = FALSE;
+		gFreeWorldBombSlots.push(*b);
+		bombs.erase(b);
+		if (bombs.empty()) gWorldBombsByGridNo.erase(i);
 		return;
 	}
 }
 
 
+std::vector<UINT32> const& GetWorldBombsInGridNo(INT16 const sGridNo)
+{
+	static std::vector<UINT32> const none;
+	auto const i = gWorldBombsByGridNo.find(sGridNo);
+	return i != gWorldBombsByGridNo.end() ? i->second : none;
+}
+
+
 INT32 FindWorldItemForBombInGridNo(const INT16 sGridNo, const INT8 bLevel)
 {
-	CFOR_EACH_WORLD_BOMB(wb)
+	for (UINT32 const bomb : GetWorldBombsInGridNo(sGridNo))
 	{
+		WORLDBOMB const& wb = gWorldBombs[bomb];
 		WORLDITEM const& wi = GetWorldItem(wb.iItemIndex);
-		if (wi.sGridNo != sGridNo || wi.ubLevel != bLevel) continue;
+		if (wi.ubLevel != bLevel) continue;
 
 		return wb.iItemIndex;
 	}
@@ -139,16 +171,16 @@ void FindPanicBombsAndTriggers(void)
 
 static INT32 GetFreeWorldItemIndex(void)
 {
-	INT32 iItemIndex;
-
-	Assert(gWorldItems.size() <= INT32_MAX);
-	for (iItemIndex = 0; iItemIndex < static_cast<INT32>(gWorldItems.size()); iItemIndex++)
+	if (!gFreeWorldItemSlots.empty())
 	{
-		if (!gWorldItems[iItemIndex].fExists) return iItemIndex;
+		INT32 const iItemIndex = gFreeWorldItemSlots.top();
+		gFreeWorldItemSlots.pop();
+		return iItemIndex;
 	}
 
+	Assert(gWorldItems.size() < INT32_MAX);
 	gWorldItems.push_back(WORLDITEM{});
-	return iItemIndex;
+	return static_cast<INT32>(gWorldItems.size() - 1);
 }
 
 
@@ -203,6 +235,7 @@ void RemoveItemFromWorld(const INT32 iItemIndex)
 		RemoveBombFromWorldByItemIndex(iItemIndex);
 	}
 	wi.fExists = FALSE;
+	gFreeWorldItemSlots.push(iItemIndex);
 }
 
 
@@ -214,6 +247,9 @@ void TrashWorldItems()
 	}
 	gWorldItems.clear();
 	gWorldBombs.clear();
+	gFreeWorldItemSlots = FreeSlots();
+	gFreeWorldBombSlots = FreeSlots();
+	gWorldBombsByGridNo.clear();
 }
 
 
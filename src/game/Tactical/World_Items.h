@@ -52,8 +52,8 @@ static inline WORLDITEM& GetWorldItem(size_t const idx)
 #define CFOR_EACH_WORLD_ITEM(iter) BASE_FOR_EACH_WORLD_ITEM(const WORLDITEM, iter)
 
 INT32 AddItemToWorld(INT16 sGridNo, const OBJECTTYPE* pObject, UINT8 ubLevel, UINT16 usFlags, INT8 bRenderZHeightAboveLevel, INT8 bVisible);
+// Frees the slot of the item for reuse, never clear fExists directly
 void RemoveItemFromWorld( INT32 iItemIndex );
-INT32 FindWorldItem( UINT16 usItem );
 
 void LoadWorldItemsFromMap(HWFILE);
 
@@ -75,6 +75,10 @@ extern std::vector<WORLDBOMB> gWorldBombs;
 #define FOR_EACH_WORLD_BOMB( iter) BASE_FOR_EACH_WORLD_BOMB(      WORLDBOMB, iter)
 #define CFOR_EACH_WORLD_BOMB(iter) BASE_FOR_EACH_WORLD_BOMB(const WORLDBOMB, iter)
 
+// Indices into gWorldBombs of the bombs at a gridno (on any level), in
+// ascending order.  The list is invalidated by adding or removing bombs.
+std::vector<UINT32> const& GetWorldBombsInGridNo(INT16 sGridNo);
+
 extern void FindPanicBombsAndTriggers( void );
 extern INT32 FindWorldItemForBombInGridNo( INT16 sGridNo, INT8 bLevel);
 
@@ -0,0 +1,68 @@
+#include "gtest/gtest.h"
+
+#include "Handle_Items.h"
+#include "World_Items.h"
+#include "WorldDef.h"
+
+#include <chrono>
+#include <stdexcept>
+
+
+// Runs 5,000 items, every tenth of them an armed bomb, through the world item
+// table.  Freed slots have to be reused lowest first and every bomb has to be
+// found at its gridno.  The time spent in each step is recorded as a test
+// property.
+TEST(WorldItems, manyItems)
+{
+	using Clock = std::chrono::steady_clock;
+	auto const micros = [](Clock::time_point const start)
+	{
+		return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count());
+	};
+	// 7 and WORLD_MAX are coprime, so every item gets a gridno of its own
+	auto const gridno = [](INT32 const i) { return static_cast<INT16>(i * 7 % WORLD_MAX); };
+	auto const flags  = [](INT32 const i) { return static_cast<UINT16>(i % 10 == 0 ? WORLD_ITEM_ARMED_BOMB : 0); };
+	INT32 const n_items = 5000;
+
+	TrashWorldItems();
+	OBJECTTYPE const o{};
+
+	Clock::time_point start = Clock::now();
+	for (INT32 i = 0; i != n_items; ++i)
+	{
+		ASSERT_EQ(AddItemToWorld(gridno(i), &o, 0, flags(i), 0, VISIBLE), i);
+	}
+	RecordProperty("add_us", micros(start));
+
+	start = Clock::now();
+	for (INT32 i = 0; i != n_items; i += 10)
+	{
+		EXPECT_EQ(FindWorldItemForBombInGridNo(gridno(i), 0), i);
+	}
+	RecordProperty("find_bomb_us", micros(start));
+	EXPECT_THROW(FindWorldItemForBombInGridNo(gridno(1), 0), std::logic_error);
+	EXPECT_THROW(FindWorldItemForBombInGridNo(gridno(0), 1), std::logic_error);
+
+	start = Clock::now();
+	for (INT32 i = 0; i != n_items; i += 2)
+	{
+		RemoveItemFromWorld(i);
+	}
+	RecordProperty("remove_us", micros(start));
+	EXPECT_EQ(gWorldItems.size(), static_cast<size_t>(n_items));
+	EXPECT_THROW(FindWorldItemForBombInGridNo(gridno(0), 0), std::logic_error);
+
+	start = Clock::now();
+	for (INT32 i = 0; i != n_items; i += 2)
+	{
+		EXPECT_EQ(AddItemToWorld(gridno(i), &o, 0, flags(i), 0, VISIBLE), i);
+	}
+	RecordProperty("readd_us", micros(start));
+	EXPECT_EQ(gWorldItems.size(), static_cast<size_t>(n_items));
+	for (INT32 i = 0; i != n_items; i += 10)
+	{
+		EXPECT_EQ(FindWorldItemForBombInGridNo(gridno(i), 0), i);
+	}
+
+	TrashWorldItems();
+}
@@ -53,9 +53,9 @@ enum
 
 #define PTR_CIV_OR_MILITIA (IsOnCivTeam(pSoldier) || pSoldier->bTeam == MILITIA_TEAM)
 
-#define REALTIME_AI_DELAY (10000 + Random( 1000 ))
-#define REALTIME_CIV_AI_DELAY ( 1000 * (gTacticalStatus.Team[ MILITIA_TEAM ].bMenInSector + gTacticalStatus.Team[ CIV_TEAM ].bMenInSector) + 5000 + 2000 * Random( 3 ) )
-#define REALTIME_CREATURE_AI_DELAY ( 10000 + 1000 * Random( 3 ) )
+#define REALTIME_AI_DELAY (10000 + Random(RNG_AI, 1000))
+#define REALTIME_CIV_AI_DELAY ( 1000 * (gTacticalStatus.Team[ MILITIA_TEAM ].bMenInSector + gTacticalStatus.Team[ CIV_TEAM ].bMenInSector) + 5000 + 2000 * Random(RNG_AI, 3) )
+#define REALTIME_CREATURE_AI_DELAY ( 10000 + 1000 * Random(RNG_AI, 3) )
 
 #define NOSHOOT_WAITABIT        -1
 #define NOSHOOT_WATER           -2
@@ -1440,7 +1440,7 @@ INT8 ExecuteAction(SOLDIERTYPE *pSoldier)
 			{
 				if ( ( gTacticalStatus.uiFlags & INCOMBAT ) )
 				{
-					if ( Random( 2 ) == 0 )
+					if ( Random( RNG_AI, 2 ) == 0 )
 					{
 						PlaySoldierJA2Sample(pSoldier, SoundRange<BLOODCAT_GROWL_1, BLOODCAT_GROWL_4>(), HIGHVOLUME, 1, TRUE);
 					}
@@ -1596,7 +1596,7 @@ INT8 ExecuteAction(SOLDIERTYPE *pSoldier)
 				if ( IS_MERC_BODY_TYPE( pSoldier ) && pSoldier->ubProfile == NO_PROFILE )
 				{
 					// CC, ATE here - I put in some TEMP randomness...
-					if ( Random( 50 ) == 0 )
+					if ( Random( RNG_AI, 50 ) == 0 )
 					{
 						StartCivQuote( pSoldier );
 					}
@@ -2007,7 +2007,7 @@ void SetNewSituation( SOLDIERTYPE * pSoldier )
 			if (!(gTacticalStatus.uiFlags & INCOMBAT))
 			{
 				// reset delay if necessary!
-				RESETTIMECOUNTER( pSoldier->AICounter, Random( 1000 ) );
+				RESETTIMECOUNTER( pSoldier->AICounter, Random( RNG_AI, 1000 ) );
 			}
 		}
 	}
@@ -2038,6 +2038,7 @@ static void HandleAITacticalTraversal(SOLDIERTYPE& s)
 	{
 		MoveSoldierFromMercToAwaySlot(&s);
 		s.bInSector = FALSE;
+		UpdateSoldierHotState(s);
 	}
 	else
 	{
@@ -342,7 +342,7 @@ UINT16 DetermineMovementMode( SOLDIERTYPE * pSoldier, INT8 bAction )
 		{
 			return( WALKING );
 		}
-		else if ( (pSoldier->ubBodyType == HATKIDCIV || pSoldier->ubBodyType == KIDCIV) && (pSoldier->bAlertStatus == STATUS_GREEN) && Random( 10 ) == 0 )
+		else if ( (pSoldier->ubBodyType == HATKIDCIV || pSoldier->ubBodyType == KIDCIV) && (pSoldier->bAlertStatus == STATUS_GREEN) && Random( RNG_AI, 10 ) == 0 )
 		{
 			return( KID_SKIPPING );
 		}
@@ -608,7 +608,7 @@ INT16 RandomFriendWithin(SOLDIERTYPE* const s)
 				UINT16 usDirection;
 				do
 				{
-					usDirection = Random(8);
+					usDirection = Random(RNG_AI, 8);
 				}
 				while (fDirChecked[usDirection]);
 
@@ -697,8 +697,8 @@ INT16 RandDestWithinRange(SOLDIERTYPE *pSoldier)
 		// only crawl 1 tile, within our roaming range
 		while ((ubTriesLeft--) && !fFound)
 		{
-			sXOffset = (INT16) Random( 3 ) - 1; // generates -1 to +1
-			sYOffset = (INT16) Random( 3 ) - 1;
+			sXOffset = (INT16) Random( RNG_AI, 3 ) - 1; // generates -1 to +1
+			sYOffset = (INT16) Random( RNG_AI, 3 ) - 1;
 
 			if (fLimited)
 			{
@@ -737,8 +737,8 @@ INT16 RandDestWithinRange(SOLDIERTYPE *pSoldier)
 		{
 			if (fLimited)
 			{
-				sXOffset = ((INT16)Random(sXRange)) - sMaxLeft;
-				sYOffset = ((INT16)Random(sYRange)) - sMaxUp;
+				sXOffset = ((INT16)Random(RNG_AI, sXRange)) - sMaxLeft;
+				sYOffset = ((INT16)Random(RNG_AI, sYRange)) - sMaxUp;
 
 				sRandDest = usOrigin + sXOffset + (MAXCOL * sYOffset);
 			}
@@ -807,7 +807,8 @@ INT16 ClosestReachableDisturbance(SOLDIERTYPE *pSoldier, UINT8 ubUnconsciousOK,
 		const SOLDIERTYPE* const pOpp = *i;
 
 		// if this merc is neutral/on same side, he's not an opponent
-		if ( CONSIDERED_NEUTRAL( pSoldier, pOpp ) || (pSoldier->bSide == pOpp->bSide) )
+		if (IsHotFriendOrNeutral(*pSoldier, GetSoldierHot(*pOpp)) ||
+			CONSIDERED_NEUTRAL( pSoldier, pOpp ) || (pSoldier->bSide == pOpp->bSide))
 		{
 			continue;          // next merc
 		}
@@ -983,7 +984,8 @@ INT16 ClosestKnownOpponent(SOLDIERTYPE *pSoldier, INT16 * psGridNo, INT8 * pbLev
 		const SOLDIERTYPE* const pOpp = *i;
 
 		// if this merc is neutral/on same side, he's not an opponent
-		if ( CONSIDERED_NEUTRAL( pSoldier, pOpp ) || (pSoldier->bSide == pOpp->bSide))
+		if (IsHotFriendOrNeutral(*pSoldier, GetSoldierHot(*pOpp)) ||
+			CONSIDERED_NEUTRAL( pSoldier, pOpp ) || (pSoldier->bSide == pOpp->bSide))
 		{
 			continue;          // next merc
 		}
@@ -1069,7 +1071,8 @@ INT16 ClosestSeenOpponent(SOLDIERTYPE *pSoldier, INT16 * psGridNo, INT8 * pbLeve
 		const SOLDIERTYPE* const pOpp = *i;
 
 		// if this merc is neutral/on same side, he's not an opponent
-		if ( CONSIDERED_NEUTRAL( pSoldier, pOpp ) || (pSoldier->bSide == pOpp->bSide))
+		if (IsHotFriendOrNeutral(*pSoldier, GetSoldierHot(*pOpp)) ||
+			CONSIDERED_NEUTRAL( pSoldier, pOpp ) || (pSoldier->bSide == pOpp->bSide))
 		{
 			continue;          // next merc
 		}
@@ -1135,50 +1138,32 @@ INT16 ClosestPC(const SOLDIERTYPE* pSoldier, INT16* psDistance)
 
 	// NOTE: skips EPCs!
 
-	INT16 sMinDist = (INT16)WORLD_MAX;
-	INT16 sDist;
-	INT16 sGridNo = NOWHERE;
-
-	CFOR_EACH_IN_TEAM(pTargetSoldier, OUR_TEAM)
+	auto const distance = [pSoldier](SOLDIERTYPE const& tgt) -> INT16
 	{
-		if (!pTargetSoldier->bInSector)
-		{
-			continue;
-		}
-
 		// if not conscious, skip him
-		if (pTargetSoldier->bLife < OKLIFE)
-		{
-			continue;
-		}
+		if (tgt.bLife < OKLIFE) return -1;
+		if (AM_AN_EPC(&tgt)) return -1;
 
-		if ( AM_AN_EPC( pTargetSoldier ) )
-		{
-			continue;
-		}
-
-		sDist = PythSpacesAway(pSoldier->sGridNo,pTargetSoldier->sGridNo);
+		INT16 sDist = PythSpacesAway(pSoldier->sGridNo, tgt.sGridNo);
 
 		// if this PC is not visible to the soldier, then add a penalty to the distance
 		// so that we weight in favour of visible mercs
-		if (pTargetSoldier->bTeam != pSoldier->bTeam && pSoldier->bOppList[pTargetSoldier->ubID] != SEEN_CURRENTLY)
+		if (tgt.bTeam != pSoldier->bTeam && pSoldier->bOppList[tgt.ubID] != SEEN_CURRENTLY)
 		{
 			sDist += 10;
 		}
+		return sDist;
+	};
 
-		if (sDist < sMinDist)
-		{
-			sMinDist = sDist;
-			sGridNo = pTargetSoldier->sGridNo;
-		}
-	}
+	INT16 sMinDist;
+	SOLDIERTYPE const* const closest = FindClosestTeamSoldier(OUR_TEAM, pSoldier->sGridNo, distance, &sMinDist);
 
 	if ( psDistance )
 	{
-		*psDistance = sMinDist;
+		*psDistance = closest ? sMinDist : (INT16)WORLD_MAX;
 	}
 
-	return( sGridNo );
+	return closest ? closest->sGridNo : NOWHERE;
 }
 
 
@@ -1474,45 +1459,39 @@ INT16 DistanceToClosestFriend( SOLDIERTYPE * pSoldier )
 	INT16 sMinDist = 1000;
 	INT16 sDist;
 
+	if (pSoldier->bInSector)
+	{
+		auto const distance = [pSoldier](SOLDIERTYPE const& tgt) -> INT16
+		{
+			if (&tgt == pSoldier) return -1;
+			// if not conscious, skip him
+			if (tgt.bLife < OKLIFE) return -1;
+			return SpacesAway(pSoldier->sGridNo, tgt.sGridNo);
+		};
+		if (FindClosestTeamSoldier(pSoldier->bTeam, pSoldier->sGridNo, distance, &sDist))
+		{
+			sMinDist = std::min(sMinDist, sDist);
+		}
+		return( sMinDist );
+	}
+
 	CFOR_EACH_IN_TEAM(pTargetSoldier, pSoldier->bTeam)
 	{
 		if (pTargetSoldier == pSoldier) continue;
 
-		if (pSoldier->bInSector)
+		// compare sector #s
+		if (pSoldier->sSector != pTargetSoldier->sSector)
 		{
-			if (!pTargetSoldier->bInSector)
-			{
-				continue;
-			}
-			// if not conscious, skip him
-			else if (pTargetSoldier->bLife < OKLIFE)
-			{
-				continue;
-			}
+			continue;
 		}
-		else
+		else if (pTargetSoldier->bLife < OKLIFE)
 		{
-			// compare sector #s
-			if (pSoldier->sSector != pTargetSoldier->sSector)
-			{
-				continue;
-			}
-			else if (pTargetSoldier->bLife < OKLIFE)
-			{
-				continue;
-			}
-			else
-			{
-				// well there's someone who could be near
-				return( 1 );
-			}
+			continue;
 		}
-
-		sDist = SpacesAway(pSoldier->sGridNo,pTargetSoldier->sGridNo);
-
-		if (sDist < sMinDist)
+		else
 		{
-			sMinDist = sDist;
+			// well there's someone who could be near
+			return( 1 );
 		}
 	}
 
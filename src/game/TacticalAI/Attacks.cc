@@ -1922,7 +1922,7 @@ INT16 CalcSpreadBurst( SOLDIERTYPE * pSoldier, INT16 sFirstTarget, INT8 bTargetL
 			pTargets[4] = NULL;
 		}
 		// now 50% chance to reorganize to fire in reverse order
-		if (Random( 2 ))
+		if (Random( RNG_AI, 2 ))
 		{
 			for( bLoop = 0; bLoop < bTargets / 2; bLoop++)
 			{
@@ -0,0 +1,100 @@
+#include "CoverField.h"
+#include "LOS.h"
+#include "Overhead.h"
+#include "Soldier_Control.h"
+#include "Structure.h"
+#include "WorldMan.h"
+
+#include <unordered_map>
+
+
+namespace
+{
+// Everything about the shooter that goes into a chance-to-get-through
+// calculation besides the world itself and his gridno.  The gridno is part of
+// the key instead, because the cover searches move opponents around virtually.
+// His position within the tile (dXPos, dYPos) does not matter, the bullets
+// always start from the centre of his gridno.
+struct ShooterCoverField
+{
+	bool   fValid      = false;
+	INT8   bLevel      = 0;
+	UINT16 usAnimState = 0;
+	UINT16 usWeapon    = 0;
+	UINT16 usHandItem  = 0;
+	UINT8  ubAmmoType  = 0;
+	std::unordered_map<uint64_t, UINT8> ctgt;
+
+	bool Matches(SOLDIERTYPE const& s) const
+	{
+		return fValid                                  &&
+			bLevel      == s.bLevel                  &&
+			usAnimState == s.usAnimState             &&
+			usWeapon    == s.usAttackingWeapon       &&
+			usHandItem  == s.inv[HANDPOS].usItem     &&
+			ubAmmoType  == s.inv[HANDPOS].ubGunAmmoType;
+	}
+
+	void Reset(SOLDIERTYPE const& s)
+	{
+		fValid      = true;
+		bLevel      = s.bLevel;
+		usAnimState = s.usAnimState;
+		usWeapon    = s.usAttackingWeapon;
+		usHandItem  = s.inv[HANDPOS].usItem;
+		ubAmmoType  = s.inv[HANDPOS].ubGunAmmoType;
+		ctgt.clear();
+	}
+};
+}
+
+
+static ShooterCoverField gCoverField[TOTAL_SOLDIERS];
+static UINT32            guiCoverFieldStructureVersion = 0;
+
+
+void InvalidateCoverField()
+{
+	for (ShooterCoverField& f : gCoverField)
+	{
+		f.fValid = false;
+		f.ctgt.clear();
+	}
+	guiCoverFieldStructureVersion = guiWorldStructureVersion;
+}
+
+
+UINT8 CoverFieldChanceToGetThrough(SOLDIERTYPE* const shooter, INT16 const sGridNo, INT8 const bLevel, INT8 const bCubeLevel, SOLDIERTYPE const* const target)
+{
+	if (guiCoverFieldStructureVersion != guiWorldStructureVersion)
+	{
+		InvalidateCoverField();
+	}
+
+	ShooterCoverField& f = gCoverField[shooter->ubID];
+	if (!f.Matches(*shooter)) f.Reset(*shooter);
+
+	uint64_t const key =
+		(uint64_t)(UINT16)sGridNo                |
+		(uint64_t)(UINT16)shooter->sGridNo << 16 |
+		(uint64_t)(UINT8)bLevel            << 32 |
+		(uint64_t)(UINT8)bCubeLevel        << 40 |
+		(uint64_t)Soldier2ID(target)       << 48;
+
+	auto const i = f.ctgt.find(key);
+	if (i != f.ctgt.end())
+	{
+		// Keep the side effect of the real calculation: the shooter remembers
+		// whom he aimed at, the soldier on the location if there is one
+		if (shooter->sGridNo != sGridNo)
+		{
+			SOLDIERTYPE const* const tgt = WhoIsThere2(sGridNo, bLevel);
+			shooter->CTGTTarget = tgt ? tgt : target;
+		}
+		return i->second;
+	}
+
+	UINT8 const ctgt = SoldierToLocationChanceToGetThrough(shooter, sGridNo, bLevel, bCubeLevel, target);
+	f.ctgt.emplace(key, ctgt);
+	return ctgt;
+}
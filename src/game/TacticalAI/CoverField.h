@@ -0,0 +1,19 @@
+#ifndef COVERFIELD_H
+#define COVERFIELD_H
+
+#include "JA2Types.h"
+
+// The cover field memoizes the chance-to-get-through from an opponent to a
+// location for the cover searches of the AI and the cover overlay.  Results
+// stay valid as long as no structure (this includes the soldiers themselves)
+// is added to or removed from the world and the shooter did not change his
+// level, stance or weapon.  The field is dropped at the start of every team
+// turn.
+
+// Memoized version of SoldierToLocationChanceToGetThrough()
+UINT8 CoverFieldChanceToGetThrough(SOLDIERTYPE* shooter, INT16 sGridNo, INT8 bLevel, INT8 bCubeLevel, const SOLDIERTYPE* target);
+
+// Throw away all memoized values
+void InvalidateCoverField();
+
+#endif
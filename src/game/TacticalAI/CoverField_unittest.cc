@@ -0,0 +1,62 @@
+#include "gtest/gtest.h"
+
+#include "Animation_Control.h"
+#include "Animation_Data.h"
+#include "CoverField.h"
+#include "DefaultContentManager.h"
+#include "DefaultContentManagerUT.h"
+#include "GameInstance.h"
+#include "LOS.h"
+#include "Overhead.h"
+#include "Soldier_Control.h"
+
+#include <memory>
+#include <utility>
+
+
+// In an empty world every answer of the cover field has to be the same as the
+// one of the calculation it memoizes, whether it was memoized yet or not
+TEST(CoverField, sameAsUncached)
+{
+	std::unique_ptr<DefaultContentManager> cm(DefaultContentManagerUT::createDefaultCMForTesting());
+	ASSERT_TRUE(cm->loadGameData());
+	auto const oldGCM = std::exchange(GCM, cm.release());
+
+	SOLDIERTYPE&      shooter = GetMan(0);
+	SOLDIERTYPE&      target  = GetMan(1);
+	SOLDIERTYPE const saved_shooter = shooter;
+	SOLDIERTYPE const saved_target  = target;
+
+	shooter = SOLDIERTYPE{};
+	shooter.ubID                = 0;
+	shooter.ubBodyType          = REGMALE;
+	shooter.usAnimState         = STANDING;
+	shooter.sGridNo             = 80 * WORLD_COLS + 80;
+	shooter.usAttackingWeapon   = GLOCK_17;
+	shooter.ubAttackingHand     = HANDPOS;
+	shooter.inv[HANDPOS].usItem = GLOCK_17;
+	target = SOLDIERTYPE{};
+	target.ubID = 1;
+
+	InvalidateCoverField();
+	INT16 const locations[] = { 80 * WORLD_COLS + 85, 70 * WORLD_COLS + 80, 90 * WORLD_COLS + 95 };
+	for (INT16 const location : locations)
+	{
+		UINT8 const expected = SoldierToLocationChanceToGetThrough(&shooter, location, 0, 0, &target);
+
+		shooter.CTGTTarget = NULL;
+		EXPECT_EQ(CoverFieldChanceToGetThrough(&shooter, location, 0, 0, &target), expected);
+		EXPECT_EQ(shooter.CTGTTarget, &target);
+
+		// the second time around the answer comes from the field
+		shooter.CTGTTarget = NULL;
+		EXPECT_EQ(CoverFieldChanceToGetThrough(&shooter, location, 0, 0, &target), expected);
+		EXPECT_EQ(shooter.CTGTTarget, &target);
+	}
+	InvalidateCoverField();
+
+	shooter = saved_shooter;
+	target  = saved_target;
+	delete GCM;
+	GCM = oldGCM;
+}
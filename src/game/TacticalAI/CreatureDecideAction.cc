@@ -878,7 +878,7 @@ static INT8 CreatureDecideActionBlack(SOLDIERTYPE* pSoldier)
 					{
 						uiChance = 20 * pSoldier->bOppCnt;
 					}
-					if ( Random( 100 ) < uiChance )
+					if ( Random( RNG_AI, 100 ) < uiChance )
 					{
 						// alert! alert!
 						if (pSoldier->bOppCnt > 1)
@@ -1107,7 +1107,7 @@ static INT8 CreatureDecideActionBlack(SOLDIERTYPE* pSoldier)
 		}
 		else
 		{
-			if (bSpitIn != NO_SLOT && Random( 4 ) )
+			if (bSpitIn != NO_SLOT && Random( RNG_AI, 4 ) )
 			{
 				// spitters only consider a blade attack 1 time in 4
 				bWeaponIn = NO_SLOT;
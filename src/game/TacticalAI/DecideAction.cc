@@ -171,7 +171,7 @@ static INT8 DecideActionSchedule(SOLDIERTYPE* pSoldier)
 								}
 								else
 								{
-									pDoor->fLocked = TRUE;
+									pDoor->setLocked(true);
 								}
 							}
 							else
@@ -285,7 +285,7 @@ static INT8 DecideActionSchedule(SOLDIERTYPE* pSoldier)
 									{
 										if (pDoor->fLocked)
 										{
-											pDoor->fLocked = FALSE;
+											pDoor->setLocked(false);
 										}
 										else
 										{
@@ -449,6 +449,7 @@ static INT8 DecideActionSchedule(SOLDIERTYPE* pSoldier)
 				case 0:
 					EVENT_SetSoldierPosition(pSoldier, pSoldier->sOffWorldGridNo, SSP_NONE);
 					pSoldier->bInSector = TRUE;
+					UpdateSoldierHotState(*pSoldier);
 					MoveSoldierFromAwayToMercSlot( pSoldier );
 					pSoldier->usActionData = usGridNo1;
 					pSoldier->bAIScheduleProgress++;
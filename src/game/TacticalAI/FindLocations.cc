@@ -5,6 +5,7 @@
 #include "Isometric_Utils.h"
 #include "AI.h"
 #include "AIInternals.h"
+#include "CoverField.h"
 #include "LOS.h"
 #include "Overhead.h"
 #include "Soldier_Profile.h"
@@ -111,7 +112,7 @@ static INT8 CalcWorstCTGTForPosition(SOLDIERTYPE* const pSoldier, const SOLDIERT
 				break;
 		}
 
-		bThisCTGT = SoldierToLocationChanceToGetThrough(pSoldier, sOppGridNo, bLevel, bCubeLevel, opponent);
+		bThisCTGT = CoverFieldChanceToGetThrough(pSoldier, sOppGridNo, bLevel, bCubeLevel, opponent);
 		if (bThisCTGT < bWorstCTGT)
 		{
 			bWorstCTGT = bThisCTGT;
@@ -152,7 +153,7 @@ static INT8 CalcAverageCTGTForPosition(SOLDIERTYPE* const pSoldier, const SOLDIE
 			default:
 				break;
 		}
-		iTotalCTGT += SoldierToLocationChanceToGetThrough(pSoldier, sOppGridNo, bLevel, bCubeLevel, opponent);
+		iTotalCTGT += CoverFieldChanceToGetThrough(pSoldier, sOppGridNo, bLevel, bCubeLevel, opponent);
 		bValidCubeLevels++;
 	}
 	iTotalCTGT /= bValidCubeLevels;
@@ -219,7 +220,11 @@ static INT8 CalcBestCTGT(SOLDIERTYPE* const pSoldier, const SOLDIERTYPE* const o
 					// "virtually" so we can calculate what our cover is from there
 
 					// NOTE: GOTTA SET THESE 3 FIELDS *BACK* AFTER USING THIS FUNCTION!!!
+					// The hot state and the soldier cells follow him there as well, so
+					// the sight tests made in between find him where he pretends to be;
+					// moving him between cells is just a few array writes.
 					pSoldier->sGridNo = sAdjSpot;     // pretend he's standing at 'sAdjSpot'
+					UpdateSoldierHotState(*pSoldier);
 					AICenterXY( sAdjSpot, &(pSoldier->dXPos), &(pSoldier->dYPos) );
 					bThisCTGT = CalcWorstCTGTForPosition(pSoldier, opponent, sOppGridNo, bLevel, iMyAPsLeft);
 					if (bThisCTGT > bBestCTGT)
@@ -267,6 +272,7 @@ static INT32 CalcCoverValue(SOLDIERTYPE* pMe, INT16 sMyGridNo, INT32 iMyThreat,
 		dMyY = pMe->dYPos;
 
 		pMe->sGridNo = sMyGridNo;              // but pretend I'm standing at sMyGridNo
+		UpdateSoldierHotState(*pMe);
 		ConvertGridNoToCenterCellXY( sMyGridNo, &sTempX, &sTempY );
 		pMe->dXPos = (FLOAT) sTempX;
 		pMe->dYPos = (FLOAT) sTempY;
@@ -280,6 +286,7 @@ static INT32 CalcCoverValue(SOLDIERTYPE* pMe, INT16 sMyGridNo, INT32 iMyThreat,
 		dHisY = pHim->dYPos;
 
 		pHim->sGridNo = sHisGridNo;            // but pretend he's standing at sHisGridNo
+		UpdateSoldierHotState(*pHim);
 		ConvertGridNoToCenterCellXY( sHisGridNo, &sTempX, &sTempY );
 		pHim->dXPos = (FLOAT) sTempX;
 		pHim->dYPos = (FLOAT) sTempY;
@@ -336,6 +343,7 @@ static INT32 CalcCoverValue(SOLDIERTYPE* pMe, INT16 sMyGridNo, INT32 iMyThreat,
 		if (pHim->sGridNo != sHisGridNo )
 		{
 			pHim->sGridNo = sHisGridNo;
+			UpdateSoldierHotState(*pHim);
 			ConvertGridNoToCenterCellXY( sHisGridNo, &sTempX, &sTempY );
 			pHim->dXPos = (FLOAT) sTempX;
 			pHim->dYPos = (FLOAT) sTempY;
@@ -360,6 +368,7 @@ static INT32 CalcCoverValue(SOLDIERTYPE* pMe, INT16 sMyGridNo, INT32 iMyThreat,
 	if (sMyRealGridNo != NOWHERE)
 	{
 		pMe->sGridNo = sMyRealGridNo;        // put me back where I belong!
+		UpdateSoldierHotState(*pMe);
 		pMe->dXPos = dMyX;                      // also change the 'x'
 		pMe->dYPos = dMyY;                      // and the 'y'
 	}
@@ -367,6 +376,7 @@ static INT32 CalcCoverValue(SOLDIERTYPE* pMe, INT16 sMyGridNo, INT32 iMyThreat,
 	if (sHisRealGridNo != NOWHERE)
 	{
 		pHim->sGridNo = sHisRealGridNo;      // put HIM back where HE belongs!
+		UpdateSoldierHotState(*pHim);
 		pHim->dXPos = dHisX;                    // also change the 'x'
 		pHim->dYPos = dHisY;                    // and the 'y'
 	}
@@ -726,7 +726,7 @@ INT16 TrackScent( SOLDIERTYPE * pSoldier )
 								{
 									ubDirDiff = 8 - ubDirDiff;
 								}
-								if (ubDirDiff < ubBestDirDiff || ((ubDirDiff == ubBestDirDiff) && Random( 2 )))
+								if (ubDirDiff < ubBestDirDiff || ((ubDirDiff == ubBestDirDiff) && Random( RNG_AI, 2 )))
 								{
 									// follow this trail as its closer to the one we're following!
 									// (in the case of a tie, we tossed a coin)
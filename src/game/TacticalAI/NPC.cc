@@ -1556,7 +1556,7 @@ void ConverseFull(UINT8 const ubNPC, UINT8 const ubMerc, Approach bApproach, UIN
 						}
 						else
 						{
-							ubQuoteNum = QUOTE_FRIENDLY_DEFAULT1 + (UINT8) Random( 2 );
+							ubQuoteNum = QUOTE_FRIENDLY_DEFAULT1 + (UINT8) Random( RNG_AI, 2 );
 							p.bFriendlyOrDirectDefaultResponseUsedRecently = TRUE;
 						}
 						break;
@@ -2237,7 +2237,7 @@ static void TriggerClosestMercWhoCanSeeNPC(UINT8 ubNPC, NPCQuoteInfo* pQuotePtr)
 	// If we are > 0
 	if ( ubNumMercs > 0 )
 	{
-		SOLDIERTYPE* const chosen = mercs_in_sector[Random(ubNumMercs)];
+		SOLDIERTYPE* const chosen = mercs_in_sector[Random(RNG_AI, ubNumMercs)];
 
 		// Post action to close panel
 		NPCClosePanel( );
@@ -2554,7 +2554,7 @@ void TriggerFriendWithHostileQuote( UINT8 ubNPC )
 	if (ubNumMercsAvailable > 0)
 	{
 		PauseAITemporarily();
-		ubChosenMerc = (UINT8) Random( ubNumMercsAvailable );
+		ubChosenMerc = (UINT8) Random( RNG_AI, ubNumMercsAvailable );
 		TriggerNPCWithIHateYouQuote( ubMercsAvailable[ ubChosenMerc ] );
 	}
 	else
@@ -242,7 +242,7 @@ static void GenerateExplosionFromExplosionPointer(EXPLOSIONTYPE* pExplosion)
 	auto sound = soundCandidates.at(0);
 	if ( soundCandidates.size() > 1 )
 	{
-		sound = soundCandidates.at(Random(soundCandidates.size()));
+		sound = soundCandidates.at(Random(RNG_SOUND, soundCandidates.size()));
 	}
 
 	PlayLocationJA2Sample(sGridNo, sound, HIGHVOLUME, 1);
@@ -879,6 +879,27 @@ BOOLEAN DishOutGasDamage(SOLDIERTYPE* const pSoldier, const SmokeEffectModel* sm
 }
 
 
+static void RollExplosiveDamage(const ExplosiveModel* const pExplosive, INT16& sWoundAmt, INT16& sBreathAmt)
+{
+	UINT32 const uiRoll = PreRandom( 100 );
+
+	// Calculate wound amount
+	sWoundAmt = pExplosive->getDamage() + (INT16) ( (pExplosive->getDamage() * uiRoll) / 100 );
+
+	// Calculate breath amount ( if stun damage applicable )
+	sBreathAmt = ( pExplosive->getStunDamage() * 100 ) + (INT16) ( ( ( pExplosive->getStunDamage() / 2 ) * 100 * uiRoll ) / 100 ) ;
+}
+
+
+void DishOutSmokeEffectDamage(SOLDIERTYPE* const pSoldier, const SMOKEEFFECT* const smoke)
+{
+	INT16 sWoundAmt;
+	INT16 sBreathAmt;
+	RollExplosiveDamage(GCM->getExplosive(smoke->usItem), sWoundAmt, sBreathAmt);
+	DishOutGasDamage(pSoldier, GCM->getSmokeEffect(static_cast<SmokeEffectID>(smoke->bType)), TRUE, FALSE, sWoundAmt, sBreathAmt, smoke->owner);
+}
+
+
 static void HandleBuldingDestruction(INT16 sGridNo, const SOLDIERTYPE* owner);
 
 
@@ -892,7 +913,6 @@ static BOOLEAN ExpAffect(const INT16 sBombGridNo, const INT16 sGridNo, const UIN
 	SmokeEffectID smokeEffectID = SmokeEffectID::NOTHING;
 	BOOLEAN	fBlastEffect = TRUE;
 	INT16		sNewGridNo;
-	UINT32	uiRoll;
 
 	if ( sSubsequent == BLOOD_SPREAD_EFFECT )
 	{
@@ -944,13 +964,8 @@ static BOOLEAN ExpAffect(const INT16 sBombGridNo, const INT16 sGridNo, const UIN
 	// OK, here we: Get explosive data
 	const ExplosiveModel* pExplosive =  GCM->getExplosive(usItem);
 
-	uiRoll = PreRandom( 100 );
-
-	// Calculate wound amount
-	sWoundAmt = pExplosive->getDamage() + (INT16) ( (pExplosive->getDamage() * uiRoll) / 100 );
-
-	// Calculate breath amount ( if stun damage applicable )
-	sBreathAmt = ( pExplosive->getStunDamage() * 100 ) + (INT16) ( ( ( pExplosive->getStunDamage() / 2 ) * 100 * uiRoll ) / 100 ) ;
+	// gas damage is rolled below, once it is known someone is hurt right away
+	if (fBlastEffect) RollExplosiveDamage(pExplosive, sWoundAmt, sBreathAmt);
 
 	// ATE: Make sure guys get pissed at us!
 	HandleBuldingDestruction(sGridNo, owner);
@@ -1095,10 +1110,14 @@ static BOOLEAN ExpAffect(const INT16 sBombGridNo, const INT16 sGridNo, const UIN
 		}
 		else
 		{
+			// while the smoke effects decay, the soldiers in the clouds are gassed in one go afterwards
+			if (smoke != NULL && RecordSmokeEffectOnTile(smoke, sGridNo, bLevel)) return fRecompileMovementCosts;
+
 			SOLDIERTYPE* const pSoldier = WhoIsThere2(sGridNo, bLevel);
 			if (pSoldier == NULL) return fRecompileMovementCosts;
 			// someone is here, and they're gonna get hurt
 
+			RollExplosiveDamage(pExplosive, sWoundAmt, sBreathAmt);
 			fRecompileMovementCosts = DishOutGasDamage(pSoldier, GCM->getSmokeEffect(smokeEffectID), sSubsequent, fRecompileMovementCosts, sWoundAmt, sBreathAmt, owner);
 		}
 
@@ -1583,13 +1602,10 @@ static void ToggleActionItemsByFrequency(INT8 bFrequency)
 
 static void TogglePressureActionItemsInGridNo(INT16 sGridNo)
 {
-	// Go through all the bombs in the world, and look for remote ones
-	CFOR_EACH_WORLD_BOMB(wb)
+	// Go through all the bombs at this location, and look for pressure ones
+	for (UINT32 const bomb : GetWorldBombsInGridNo(sGridNo))
 	{
-		WORLDITEM& wi = GetWorldItem(wb.iItemIndex);
-		if (wi.sGridNo != sGridNo) continue;
-
-		OBJECTTYPE& o = wi.o;
+		OBJECTTYPE& o = GetWorldItem(gWorldBombs[bomb].iItemIndex).o;
 		if (o.bDetonatorType == BOMB_PRESSURE)
 		{
 			// Found a pressure item
@@ -1710,7 +1726,7 @@ static void PerformItemAction(INT16 sGridNo, OBJECTTYPE* pObj)
 				pDoor = FindDoorInfoAtGridNo( sGridNo );
 				if ( pDoor )
 				{
-					pDoor->fLocked = FALSE;
+					pDoor->setLocked(false);
 				}
 			}
 			break;
@@ -1723,11 +1739,11 @@ static void PerformItemAction(INT16 sGridNo, OBJECTTYPE* pObj)
 				{
 					if ( pDoor->fLocked )
 					{
-						pDoor->fLocked = FALSE;
+						pDoor->setLocked(false);
 					}
 					else
 					{
-						pDoor->fLocked = TRUE;
+						pDoor->setLocked(true);
 					}
 				}
 			}
@@ -2229,20 +2245,16 @@ void SetOffPanicBombs(SOLDIERTYPE* const s, const INT8 bPanicTrigger)
 
 BOOLEAN SetOffBombsInGridNo(SOLDIERTYPE* const s, const INT16 sGridNo, const BOOLEAN fAllBombs, const INT8 bLevel)
 {
-	UINT32  uiWorldBombIndex;
 	UINT32  uiTimeStamp;
 	BOOLEAN fFoundMine = FALSE;
 
 	uiTimeStamp = GetJA2Clock();
 
-	// Go through all the bombs in the world, and look for mines at this location
-	Assert(gWorldBombs.size() <= UINT32_MAX);
-	for (uiWorldBombIndex = 0; uiWorldBombIndex < static_cast<UINT32>(gWorldBombs.size()); uiWorldBombIndex++)
+	// Go through all the bombs at this location, and look for mines
+	for (UINT32 const uiWorldBombIndex : GetWorldBombsInGridNo(sGridNo))
 	{
-		if (!gWorldBombs[uiWorldBombIndex].fExists) continue;
-
 		WORLDITEM const& wi = GetWorldItem(gWorldBombs[uiWorldBombIndex].iItemIndex);
-		if (wi.sGridNo != sGridNo || wi.ubLevel != bLevel) continue;
+		if (wi.ubLevel != bLevel) continue;
 
 		OBJECTTYPE const& o = wi.o;
 		if (!(o.fFlags & OBJECT_DISABLED_BOMB))
@@ -2298,13 +2310,10 @@ BOOLEAN SetOffBombsInGridNo(SOLDIERTYPE* const s, const INT16 sGridNo, const BOO
 
 void ActivateSwitchInGridNo(SOLDIERTYPE* const s, const INT16 sGridNo)
 {
-	// Go through all the bombs in the world, and look for mines at this location
-	CFOR_EACH_WORLD_BOMB(wb)
+	// Go through all the bombs at this location, and look for switches
+	for (UINT32 const bomb : GetWorldBombsInGridNo(sGridNo))
 	{
-		WORLDITEM const& wi = GetWorldItem(wb.iItemIndex);
-		if (wi.sGridNo != sGridNo) continue;
-
-		OBJECTTYPE const& o = wi.o;
+		OBJECTTYPE const& o = GetWorldItem(gWorldBombs[bomb].iItemIndex).o;
 		if (o.usItem == SWITCH && !(o.fFlags & OBJECT_DISABLED_BOMB) && o.bDetonatorType == BOMB_SWITCH)
 		{
 			// send out a signal to detonate other bombs, rather than this which
@@ -74,6 +74,8 @@ void RemoveAllActiveTimedBombs( void );
 #define GASMASK_MIN_STATUS 70
 
 BOOLEAN DishOutGasDamage(SOLDIERTYPE* pSoldier, const SmokeEffectModel* smokeEffect, INT16 sSubsequent, BOOLEAN fRecompileMovementCosts, INT16 sWoundAmt, INT16 sBreathAmt, SOLDIERTYPE* owner);
+// Gasses a soldier standing in a smoke effect, unless already affected by this kind of gas in this round
+void DishOutSmokeEffectDamage(SOLDIERTYPE* pSoldier, const SMOKEEFFECT* smoke);
 
 void HandleExplosionQueue();
 
@@ -39,6 +39,7 @@
 #include <algorithm>
 #include <math.h>
 #include <stdexcept>
+#include <unordered_map>
 
 #define NO_TEST_OBJECT				0
 #define TEST_OBJECT_NO_COLLISIONS		1
@@ -1629,7 +1630,7 @@ static void CalculateLaunchItemBasicParams(const SOLDIERTYPE* pSoldier, const OB
 }
 
 
-BOOLEAN CalculateLaunchItemChanceToGetThrough(const SOLDIERTYPE* pSoldier, const OBJECTTYPE* pItem, INT16 sGridNo, UINT8 ubLevel, INT16 sEndZ, INT16* psFinalGridNo, BOOLEAN fArmed, INT8* pbLevel, BOOLEAN fFromUI)
+static BOOLEAN SimulateLaunchItemChanceToGetThrough(const SOLDIERTYPE* pSoldier, const OBJECTTYPE* pItem, INT16 sGridNo, UINT8 ubLevel, INT16 sEndZ, INT16* psFinalGridNo, BOOLEAN fArmed, INT8* pbLevel, BOOLEAN fFromUI)
 {
 	FLOAT    dForce, dDegrees;
 	INT16    sDestX, sDestY, sSrcX, sSrcY;
@@ -1693,6 +1694,92 @@ BOOLEAN CalculateLaunchItemChanceToGetThrough(const SOLDIERTYPE* pSoldier, const
 }
 
 
+namespace
+{
+// Everything a launch arc depends on besides the world structures
+struct LaunchArcKey
+{
+	INT16   sSrcGridNo;
+	INT8    bSrcLevel;
+	INT16   sGridNo;
+	UINT8   ubLevel;
+	INT16   sEndZ;
+	UINT16  usItem;
+	INT32   iMaxTossRange;
+	BOOLEAN fArmed;
+	BOOLEAN fFromUI;
+
+	bool operator==(LaunchArcKey const& o) const
+	{
+		return sSrcGridNo    == o.sSrcGridNo    &&
+			bSrcLevel     == o.bSrcLevel     &&
+			sGridNo       == o.sGridNo       &&
+			ubLevel       == o.ubLevel       &&
+			sEndZ         == o.sEndZ         &&
+			usItem        == o.usItem        &&
+			iMaxTossRange == o.iMaxTossRange &&
+			fArmed        == o.fArmed        &&
+			fFromUI       == o.fFromUI;
+	}
+};
+
+struct LaunchArcKeyHash
+{
+	size_t operator()(LaunchArcKey const& k) const
+	{
+		size_t h = (UINT16)k.sSrcGridNo | (UINT32)(UINT16)k.sGridNo << 16;
+		h = h * 31 + ((UINT16)k.sEndZ | (UINT32)k.usItem << 16);
+		h = h * 31 + (k.iMaxTossRange << 4 | k.bSrcLevel << 3 | k.ubLevel << 2 | k.fArmed << 1 | k.fFromUI);
+		return h;
+	}
+};
+
+struct LaunchArc
+{
+	BOOLEAN fGetsThrough;
+	INT16   sFinalGridNo;
+	INT8    bFinalLevel;
+};
+}
+
+// Simulated launch arcs, valid until a structure is added to or removed from
+// the world.  The AI evaluates the same arcs over and over again when it looks
+// for a place to toss a grenade, the UI does the same while the cursor rests.
+static std::unordered_map<LaunchArcKey, LaunchArc, LaunchArcKeyHash> gLaunchArcs;
+static UINT32 guiLaunchArcsStructureVersion = 0;
+
+#define MAX_MEMOIZED_LAUNCH_ARCS 4096
+
+
+BOOLEAN CalculateLaunchItemChanceToGetThrough(const SOLDIERTYPE* pSoldier, const OBJECTTYPE* pItem, INT16 sGridNo, UINT8 ubLevel, INT16 sEndZ, INT16* psFinalGridNo, BOOLEAN fArmed, INT8* pbLevel, BOOLEAN fFromUI)
+{
+	if (guiLaunchArcsStructureVersion != guiWorldStructureVersion ||
+		gLaunchArcs.size() >= MAX_MEMOIZED_LAUNCH_ARCS)
+	{
+		gLaunchArcs.clear();
+		guiLaunchArcsStructureVersion = guiWorldStructureVersion;
+	}
+
+	LaunchArcKey const key =
+	{
+		pSoldier->sGridNo, pSoldier->bLevel, sGridNo, ubLevel, sEndZ, pItem->usItem,
+		CalcMaxTossRange(pSoldier, pItem->usItem, fArmed), fArmed, fFromUI
+	};
+
+	auto const i = gLaunchArcs.find(key);
+	if (i != gLaunchArcs.end())
+	{
+		*psFinalGridNo = i->second.sFinalGridNo;
+		*pbLevel       = i->second.bFinalLevel;
+		return i->second.fGetsThrough;
+	}
+
+	BOOLEAN const fGetsThrough = SimulateLaunchItemChanceToGetThrough(pSoldier, pItem, sGridNo, ubLevel, sEndZ, psFinalGridNo, fArmed, pbLevel, fFromUI);
+	gLaunchArcs.emplace(key, LaunchArc{ fGetsThrough, *psFinalGridNo, *pbLevel });
+	return fGetsThrough;
+}
+
+
 static FLOAT CalculateForceFromRange(INT16 sRange, FLOAT dDegrees)
 {
 	FLOAT      dMagForce;
@@ -1102,8 +1102,14 @@ zlevel_topmost:
 									pShadeTable = s.pForcedShade;
 								}
 
-								hVObject = gAnimSurfaceDatabase[usAnimSurface].hVideoObject;
-								if (!hVObject) goto next_node;
+								hVObject     = gAnimSurfaceDatabase[usAnimSurface].hVideoObject;
+								usImageIndex = s.usAniFrame;
+								if (!hVObject)
+								{
+									// Still loading in the background
+									hVObject = GetSoldierAnimationPlaceholder(s, usImageIndex);
+									if (!hVObject) goto next_node;
+								}
 
 								// ATE: If we are in a gridno that we should not use obscure blitter, set!
 								if (!(me.ubExtFlags[0] & MAPELEMENT_EXT_NOBURN_STRUCT))
@@ -1116,8 +1122,6 @@ zlevel_topmost:
 									sZLevel += 2;
 								}
 
-								usImageIndex = s.usAniFrame;
-
 								uiDirtyFlags = BGND_FLAG_SINGLE | BGND_FLAG_ANIMATED;
 								break;
 							}
@@ -19,12 +19,14 @@
 #include "OppList.h"
 #include "Tactical_Save.h"
 #include "Campaign_Types.h"
+#include "Structure.h"
 
 #include "ContentManager.h"
 #include "GameInstance.h"
 
 #include <algorithm>
 #include <stdexcept>
+#include <vector>
 
 #define NUM_SMOKE_EFFECT_SLOTS 25
 
@@ -33,6 +35,21 @@
 static SMOKEEFFECT gSmokeEffectData[NUM_SMOKE_EFFECT_SLOTS];
 static UINT32      guiNumSmokeEffects = 0;
 
+// While the smoke effects decay, the spreading clouds only record which tiles
+// they cover, per kind of gas and level.  Each entry holds the slot + 1 of the
+// first cloud to cover the tile, 0 if none.  The soldiers standing in the
+// clouds are gassed in a single pass afterwards.
+#define NUM_SMOKE_EFFECT_TYPES (static_cast<int>(SmokeEffectID::CREATUREGAS) + 1)
+
+static bool               gfRecordSmokeCoverage = false;
+static std::vector<UINT8> gSmokeCoverage;
+
+
+static UINT8& SmokeCoverage(SmokeEffectID const type, INT16 const sGridNo, INT8 const bLevel)
+{
+	return gSmokeCoverage[(static_cast<int>(type) * 2 + (bLevel != 0)) * WORLD_MAX + sGridNo];
+}
+
 
 #define BASE_FOR_EACH_SMOKE_EFFECT(type, iter)                    \
 	for (type* iter        = gSmokeEffectData,                      \
@@ -329,6 +346,76 @@ void RemoveSmokeEffectFromTile( INT16 sGridNo, INT8 bLevel )
 }
 
 
+bool RecordSmokeEffectOnTile(SMOKEEFFECT const* const s, INT16 const sGridNo, INT8 const bLevel)
+{
+	if (!gfRecordSmokeCoverage) return false;
+
+	UINT8& slot = SmokeCoverage(static_cast<SmokeEffectID>(s->bType), sGridNo, bLevel);
+	if (slot == 0) slot = static_cast<UINT8>(s - gSmokeEffectData + 1);
+	return true;
+}
+
+
+static SMOKEEFFECT const* GetRecordedSmokeEffect(SmokeEffectID const type, INT16 const sGridNo, INT8 const bLevel)
+{
+	UINT8 const slot = SmokeCoverage(type, sGridNo, bLevel);
+	if (slot == 0) return NULL;
+	SMOKEEFFECT const* const s = &gSmokeEffectData[slot - 1];
+	return s->fAllocated ? s : NULL;
+}
+
+
+// Mirrors WhoIsThere2(): a soldier occupying several tiles is in a cloud if
+// any of its impassable tiles is
+static SMOKEEFFECT const* GetSmokeEffectAroundSoldier(SOLDIERTYPE const& s, SmokeEffectID const type)
+{
+	STRUCTURE const* const base = s.uiStatusFlags & SOLDIER_MULTITILE ? s.pLevelNode->pStructureData : NULL;
+	if (!base) return GetRecordedSmokeEffect(type, s.sGridNo, s.bLevel);
+
+	DB_STRUCTURE_REF const* const sr = base->pDBStructureRef;
+	for (UINT8 i = 0; i < sr->pDBStructure->ubNumberOfTiles; ++i)
+	{
+		DB_STRUCTURE_TILE const* const tile = sr->ppTile[i];
+		INT16 const sGridNo = base->sGridNo + tile->sPosRelToBase;
+		if (tile->fFlags & TILE_PASSABLE && sGridNo != s.sGridNo) continue;
+		if (!GridNoOnVisibleWorldTile(sGridNo)) continue;
+
+		SMOKEEFFECT const* const smoke = GetRecordedSmokeEffect(type, sGridNo, s.bLevel);
+		if (smoke) return smoke;
+	}
+	return NULL;
+}
+
+
+static void GasSoldiersInSmokeEffects()
+{
+	bool fAnyMercHit = false;
+	FOR_EACH_MERC(i)
+	{
+		SOLDIERTYPE& s = **i;
+		// like WhoIsThere2(), only find soldiers who are on the map, which
+		// leaves out the passengers and drivers of vehicles
+		if (s.sGridNo == NOWHERE || !s.pLevelNode) continue;
+		if (s.uiStatusFlags & (SOLDIER_DRIVER | SOLDIER_PASSENGER)) continue;
+
+		for (int type = 0; type != NUM_SMOKE_EFFECT_TYPES; ++type)
+		{
+			SMOKEEFFECT const* const smoke = GetSmokeEffectAroundSoldier(s, static_cast<SmokeEffectID>(type));
+			if (!smoke) continue;
+
+			DishOutSmokeEffectDamage(&s, smoke);
+			fAnyMercHit = true;
+		}
+	}
+
+	if (fAnyMercHit)
+	{
+		// reset explosion hit flag so we can damage mercs again
+		FOR_EACH_MERC(i) (*i)->ubMiscSoldierFlags &= ~SOLDIER_MISC_HURT_BY_EXPLOSION;
+	}
+}
+
+
 void DecaySmokeEffects(const UINT32 uiTime, const bool updateSightings)
 {
 	BOOLEAN fUpdate = FALSE;
@@ -339,6 +426,9 @@ void DecaySmokeEffects(const UINT32 uiTime, const bool updateSightings)
 	// reset 'hit by gas' flags
 	FOR_EACH_MERC(i) (*i)->fHitByGasFlags = 0;
 
+	gSmokeCoverage.assign(NUM_SMOKE_EFFECT_TYPES * 2 * WORLD_MAX, 0);
+	gfRecordSmokeCoverage = true;
+
 	// ATE: 1 ) make first pass and delete/mark any smoke effect for update
 	// all the deleting has to be done first///
 
@@ -448,6 +538,9 @@ void DecaySmokeEffects(const UINT32 uiTime, const bool updateSightings)
 		}
 	}
 
+	gfRecordSmokeCoverage = false;
+	GasSoldiersInSmokeEffects();
+
 	if (updateSightings) AllTeamsLookForAll(TRUE);
 }
 
@@ -36,6 +36,10 @@ bool IsSoldierAlreadyAffectedBySmokeEffect(const SOLDIERTYPE*, const SmokeEffect
 // Decays all smoke effects...
 void DecaySmokeEffects(UINT32 uiTime, bool updateSightings);
 
+// While the smoke effects decay, notes that a cloud covers a tile instead of
+// gassing whoever stands there right away.  Returns false at any other time.
+bool RecordSmokeEffectOnTile(SMOKEEFFECT const*, INT16 sGridNo, INT8 bLevel);
+
 // Add smoke to gridno
 // ( Replacement algorithm uses distance away )
 void AddSmokeEffectToTile(SMOKEEFFECT const*, const SmokeEffectModel*, INT16 sGridNo, INT8 bLevel);
@@ -56,6 +56,8 @@
 
 UINT8 AtHeight[PROFILE_Z_SIZE] = { 0x01, 0x02, 0x04, 0x08 };
 
+UINT32 guiWorldStructureVersion = 0;
+
 constexpr UINT16 FIRST_AVAILABLE_STRUCTURE_ID = INVALID_STRUCTURE_ID + 2;
 
 static UINT16 gusNextAvailableStructureID = FIRST_AVAILABLE_STRUCTURE_ID;
@@ -810,6 +812,7 @@ try
 
 	STRUCTURE* const base = structures[BASE_TILE];
 	pLevelNode->pStructureData = base;
+	++guiWorldStructureVersion;
 	return base;
 }
 catch (...) { return 0; }
@@ -849,6 +852,7 @@ BOOLEAN DeleteStructureFromWorld(STRUCTURE* const structure)
 	GridNo              const base_grid_no           = base->sGridNo;
 	DB_STRUCTURE_TILE** const tile                   = base->pDBStructureRef->ppTile;
 	DB_STRUCTURE_TILE** const end_tile               = tile + base->pDBStructureRef->pDBStructure->ubNumberOfTiles;
+	++guiWorldStructureVersion;
 	// Free all the tiles
 	for (DB_STRUCTURE_TILE* const* i = tile; i != end_tile; ++i)
 	{
@@ -139,6 +139,10 @@ SoundID GetStructureOpenSound(STRUCTURE const*, bool closing);
 
 extern const UINT8 gubMaterialArmour[];
 
+// Incremented whenever a structure is added to or removed from the world, so
+// caches of line of fire data can tell when they went stale
+extern UINT32 guiWorldStructureVersion;
+
 typedef SGP::AutoObj<STRUCTURE_FILE_REF, FreeStructureFile> AutoStructureFileRef;
 
 #endif
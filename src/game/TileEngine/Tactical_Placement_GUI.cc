@@ -878,6 +878,7 @@ static void PutDownMercPiece(MERCPLACEMENT& m)
 		s.ubInsertionDirection = s.bDirection;
 		m.fPlaced = TRUE;
 		m.pSoldier->bInSector = TRUE;
+		UpdateSoldierHotState(*m.pSoldier);
 	}
 }
 
@@ -888,6 +889,7 @@ static void PickUpMercPiece(MERCPLACEMENT& m)
 	SOLDIERTYPE& s = *m.pSoldier;
 	RemoveSoldierFromGridNo(s);
 	s.bInSector = FALSE;
+	UpdateSoldierHotState(s);
 }
 
 
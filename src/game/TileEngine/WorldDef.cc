@@ -58,6 +58,7 @@
 #include "WorldDat.h"
 #include "WorldMan.h"
 #include <cstdint>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <string_theory/format>
@@ -378,6 +379,8 @@ static void CompileTileMovementCosts(UINT16 usGridNo)
 		return;
 	}
 
+	InvalidateReachableComponentsAt(usGridNo);
+
 	if ( GridNoOnVisibleWorldTile( usGridNo ) )
 	{
 		// check for land of a different height in adjacent locations
@@ -1403,6 +1406,7 @@ void CompileWorldMovementCosts( )
 	{
 		CompileTileMovementCosts( usGridNo );
 	}
+	ResetReachableComponents();
 }
 
 
@@ -1801,44 +1805,28 @@ void InitLoadedWorld(void)
 extern double MasterStart, MasterEnd;
 extern BOOLEAN gfUpdatingNow;
 
-/* This is a specialty function that is very similar to LoadWorld, except that
- * it doesn't actually load the world, it instead evaluates the map and
- * generates summary information for use within the summary editor.  The header
- * is defined in Summary Info.h, not worlddef.h -- though it's not likely this
- * is going to be used anywhere where it would matter. */
-BOOLEAN EvaluateWorld(const ST::string& pSector, const UINT8 ubLevel)
-try
+
+ST::string GetSummaryMapFilename(const ST::string& pSector, const UINT8 ubLevel)
 {
-	// Make sure the file exists... if not, then return false
-	ST::string filename = ST::format("{}{}{.0d}{}.dat",
+	return ST::format("{}{}{.0d}{}.dat",
 		pSector,
 		ubLevel % 4 != 0 ? "_b" : "",
 		ubLevel % 4,
 		ubLevel     >= 4 ? "_a" : ""
 	);
+}
 
-	if (gfMajorUpdate)
-	{
-		LoadWorld(filename);
-		SaveWorldAbsolute(filename);
-	}
-
-	AutoSGPFile f(GCM->openMapForReading(filename));
 
-	ST::string str = ST::format("Analyzing map {}", filename);
-	if (!gfUpdatingNow)
-	{
-		SetRelativeStartAndEndPercentage(0, 0, 100, str);
-	}
-	else
-	{
-		SetRelativeStartAndEndPercentage(0, (UINT16)MasterStart, (UINT16)MasterEnd, str);
-	}
+static void ReportProgress(void (*const progress)(UINT32), UINT32 const percentage)
+{
+	if (progress) progress(percentage);
+}
 
-	RenderProgressBar(0, 0);
 
+SUMMARYFILE* EvaluateWorldFile(HWFILE const f, void (*const progress)(UINT32 percentage))
+{
 	//clear the summary file info
-	SUMMARYFILE* const pSummary = new SUMMARYFILE{};
+	std::unique_ptr<SUMMARYFILE> pSummary{new SUMMARYFILE{}};
 	pSummary->ubSummaryVersion = GLOBAL_SUMMARY_VERSION;
 	pSummary->dMajorMapVersion = getMajorMapVersion();
 
@@ -1866,7 +1854,7 @@ try
 	INT32 skip = 0;
 	for (UINT32 row = 0; row != WORLD_ROWS; ++row)
 	{
-		if (row % 16 == 0) RenderProgressBar(0, row * 90 / WORLD_ROWS + 1); // 1 - 90
+		if (row % 16 == 0) ReportProgress(progress, row * 90 / WORLD_ROWS + 1); // 1 - 90
 
 		UINT8 combine[WORLD_COLS][4];
 		f->read(combine, sizeof(combine));
@@ -1898,7 +1886,7 @@ try
 
 	if (uiFlags & MAP_WORLDITEMS_SAVED)
 	{
-		RenderProgressBar(0, 91);
+		ReportProgress(progress, 91);
 		//Important:  Saves the file position (byte offset) of the position where the numitems
 		//            resides.  Checking this value and comparing to usNumItems will ensure validity.
 		pSummary->uiNumItemsPosition = f->pos();
@@ -1914,7 +1902,7 @@ try
 
 	if (uiFlags & MAP_WORLDLIGHTS_SAVED)
 	{
-		RenderProgressBar(0, 92);
+		ReportProgress(progress, 92);
 
 		//skip number of light palette entries
 		UINT8 n_light_colours;
@@ -1938,7 +1926,7 @@ try
 
 	if (uiFlags & MAP_FULLSOLDIER_SAVED)
 	{
-		RenderProgressBar(0, 94);
+		ReportProgress(progress, 94);
 
 		pSummary->uiEnemyPlacementPosition = f->pos();
 
@@ -2059,12 +2047,12 @@ try
 			}
 			++pTeam->ubTotal;
 		}
-		RenderProgressBar(0, 96);
+		ReportProgress(progress, 96);
 	}
 
 	if (uiFlags & MAP_EXITGRIDS_SAVED)
 	{
-		RenderProgressBar(0, 98);
+		ReportProgress(progress, 98);
 
 		UINT16 cnt;
 		f->read(&cnt, sizeof(cnt));
@@ -2120,7 +2108,49 @@ try
 		}
 	}
 
-	RenderProgressBar(0, 100);
+	ReportProgress(progress, 100);
+	return pSummary.release();
+}
+
+
+static void RenderEvaluationProgress(UINT32 const percentage)
+{
+	RenderProgressBar(0, percentage);
+}
+
+
+/* This is a specialty function that is very similar to LoadWorld, except that
+ * it doesn't actually load the world, it instead evaluates the map and
+ * generates summary information for use within the summary editor.  The header
+ * is defined in Summary Info.h, not worlddef.h -- though it's not likely this
+ * is going to be used anywhere where it would matter. */
+BOOLEAN EvaluateWorld(const ST::string& pSector, const UINT8 ubLevel)
+try
+{
+	// Make sure the file exists... if not, then return false
+	ST::string filename = GetSummaryMapFilename(pSector, ubLevel);
+
+	if (gfMajorUpdate)
+	{
+		LoadWorld(filename);
+		SaveWorldAbsolute(filename);
+	}
+
+	AutoSGPFile f(GCM->openMapForReading(filename));
+
+	ST::string str = ST::format("Analyzing map {}", filename);
+	if (!gfUpdatingNow)
+	{
+		SetRelativeStartAndEndPercentage(0, 0, 100, str);
+	}
+	else
+	{
+		SetRelativeStartAndEndPercentage(0, (UINT16)MasterStart, (UINT16)MasterEnd, str);
+	}
+
+	RenderProgressBar(0, 0);
+
+	SUMMARYFILE* const pSummary = EvaluateWorldFile(f, RenderEvaluationProgress);
 
 	WriteSectorSummaryUpdate(filename, ubLevel, pSummary);
 	return TRUE;
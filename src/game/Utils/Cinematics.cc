@@ -8,6 +8,8 @@
 //------------------------------------------------------------------------------
 
 #include <cmath>
+#include <condition_variable>
+#include <mutex>
 #include <vector>
 
 #include <SDL.h>
@@ -24,11 +26,26 @@ extern "C" {
 #include "sgp/VSurface.h"
 #include "sgp/SoundMan.h"
 
+
+// Number of frames the decoder thread may run ahead of the displayed frame.
+// This bounds both the memory of the decoded frames and the audio lead.
+#define SMK_FRAMES_AHEAD 8
+#define SMK_AUDIO_TRACKS 7
+
+
+struct SMKFRAME
+{
+	std::vector<UINT8> video;
+	UINT8 palette[256 * 3];
+	std::vector<UINT8> audio[SMK_AUDIO_TRACKS];
+};
+
+
 struct SMKFLIC
 {
 	unsigned char* file_in_memory;
 	smk smacker; // object pointer type for libsmacker
-	UINT32 sounds[7];
+	UINT32 sounds[SMK_AUDIO_TRACKS];
 	UINT32 flags;
 	UINT32 left;
 	UINT32 top;
@@ -36,6 +53,22 @@ struct SMKFLIC
 	UINT32 frame_no;
 	double milliseconds_per_frame;
 	signed char status;
+	unsigned long width;
+	unsigned long height;
+	SMKFRAME current; // the frame on display
+
+	// Frames decoded ahead by the decoder thread. The thread owns the smacker
+	// object while it runs and only fills the free slots of the ring, so the
+	// lock just guards the counters below.
+	SDL_Thread* decoder;
+	std::mutex mutex;
+	std::condition_variable cond;
+	SMKFRAME ring[SMK_FRAMES_AHEAD];
+	UINT32 ring_head;
+	UINT32 ring_count;
+	UINT32 audio_queued; // frames at the ring head whose audio went to the sound streams
+	signed char decoder_status;
+	bool decoder_quit;
 };
 
 
@@ -43,6 +76,7 @@ struct SMKFLIC
 #define SMK_FLIC_OPEN      0x00000001 // Flic is open
 #define SMK_FLIC_PLAYING   0x00000002 // Flic is playing
 #define SMK_FLIC_AUTOCLOSE 0x00000008 // Close when done
+#define SMK_FLIC_AUDIO_END 0x00000010 // Sound streams have been ended
 
 
 static SMKFLIC gSmkList[4];
@@ -50,6 +84,7 @@ static SMKFLIC gSmkList[4];
 
 static SMKFLIC* SmkOpenFlic(const char* filename);
 static SMKFLIC* SmkGetFreeFlic(void);
+static void SmkQueueAudio(SMKFLIC* sf);
 static void SmkSkipFrames(SMKFLIC* sf);
 static void SmkBlitVideoFrame(SMKFLIC* const sf, SGPVSurface* surface);
 
@@ -61,6 +96,7 @@ BOOLEAN SmkPollFlics(void)
 	{
 		if (!(sf->flags & SMK_FLIC_PLAYING)) continue;
 
+		SmkQueueAudio(sf);
 		SmkSkipFrames(sf);
 
 		if (sf->status == SMK_DONE || sf->status == SMK_ERROR)
@@ -92,6 +128,7 @@ void SmkInitialize(void)
 	{
 		sf->file_in_memory = nullptr;
 		sf->smacker = nullptr;
+		sf->decoder = nullptr;
 		FOR_EACH(UINT32, sound, sf->sounds)
 		{
 			*sound = NO_SAMPLE;
@@ -110,6 +147,77 @@ void SmkShutdown(void)
 }
 
 
+// Copies the frame the smacker object is at
+static void SmkStoreFrame(SMKFLIC* const sf, SMKFRAME& frame)
+{
+	const unsigned char* video = smk_get_video(sf->smacker);
+	if (video != nullptr)
+	{
+		frame.video.assign(video, video + sf->width * sf->height);
+	}
+	else
+	{
+		frame.video.clear();
+	}
+
+	const unsigned char* palette = smk_get_palette(sf->smacker);
+	if (palette != nullptr) std::copy_n(palette, lengthof(frame.palette), frame.palette);
+
+	for (uint8_t i = 0; i < SMK_AUDIO_TRACKS; i++)
+	{
+		frame.audio[i].clear();
+		if (sf->sounds[i] == NO_SAMPLE) continue;
+		unsigned long audio_size = smk_get_audio_size(sf->smacker, i);
+		if (audio_size > 0)
+		{
+			const unsigned char* audio_data = smk_get_audio(sf->smacker, i);
+			frame.audio[i].assign(audio_data, audio_data + audio_size);
+		}
+	}
+}
+
+
+// Hands the audio of a frame over to the sound streams
+static void SmkQueueFrameAudio(SMKFLIC* const sf, const SMKFRAME& frame)
+{
+	for (uint8_t i = 0; i < SMK_AUDIO_TRACKS; i++)
+	{
+		const std::vector<UINT8>& audio = frame.audio[i];
+		if (!audio.empty()) SoundStreamQueue(sf->sounds[i], audio.data(), static_cast<UINT32>(audio.size()));
+	}
+}
+
+
+// Decoder thread, keeps the ring filled until the flic ends or is closed
+static int SmkDecodeFrames(void* const ptr)
+{
+	SMKFLIC* const sf = static_cast<SMKFLIC*>(ptr);
+	for (;;)
+	{
+		UINT32 slot;
+		{
+			std::unique_lock<std::mutex> lk(sf->mutex);
+			sf->cond.wait(lk, [sf]{ return sf->decoder_quit || sf->ring_count < SMK_FRAMES_AHEAD; });
+			if (sf->decoder_quit) return 0;
+			slot = (sf->ring_head + sf->ring_count) % SMK_FRAMES_AHEAD;
+		}
+
+		const signed char status = smk_next(sf->smacker);
+		if (status == SMK_DONE || status == SMK_ERROR)
+		{
+			if (status == SMK_ERROR) SLOGW("smacker failed to decode a frame");
+			std::lock_guard<std::mutex> lk(sf->mutex);
+			sf->decoder_status = status;
+			return 0;
+		}
+		SmkStoreFrame(sf, sf->ring[slot]);
+
+		std::lock_guard<std::mutex> lk(sf->mutex);
+		sf->ring_count++;
+	}
+}
+
+
 SMKFLIC* SmkPlayFlic(const char* const filename, const UINT32 left, const UINT32 top, const BOOLEAN auto_close)
 {
 	char status;
@@ -120,59 +228,63 @@ SMKFLIC* SmkPlayFlic(const char* const filename, const UINT32 left, const UINT32
 	sf->left = left;
 	sf->top  = top;
 
-	// Get all the audio data
-	unsigned char audio_tracks;
-	unsigned char audio_channels[7];
-	unsigned char audio_depth[7];
-	unsigned long audio_rate[7];
-	std::vector<UINT8> audio[7];
-	if (smk_info_audio(sf->smacker, &audio_tracks, audio_channels, audio_depth, audio_rate) == 0 && audio_tracks != 0)
-	{
-		status = smk_enable_all(sf->smacker, audio_tracks);
-		Assert(status == 0);
-
-		for (sf->status = smk_first(sf->smacker); sf->status != SMK_DONE; sf->status = smk_next(sf->smacker))
-		{
-			if (sf->status == SMK_ERROR)
-			{
-				SLOGW("smacker failed to decode audio data");
-				break;
-			}
-			for (uint8_t i = 0; i < 7; i++)
-			{
-				if (!(audio_tracks & (1 << i))) continue;
-				unsigned long audio_size = smk_get_audio_size(sf->smacker, i);
-				if (audio_size > 0)
-				{
-					unsigned char* audio_data = smk_get_audio(sf->smacker, i);
-					audio[i].insert(audio[i].end(), audio_data, audio_data + audio_size);
-				}
-			}
-		}
-	}
-
 	// get play speed
 	// the video is too slow using microsecond resolution, speed it up by rounding down to milliseconds
 	double microseconds_per_frame;
 	status = smk_info_all(sf->smacker, nullptr, nullptr, &microseconds_per_frame);
 	Assert(status == 0);
 	sf->milliseconds_per_frame = microseconds_per_frame / 1000.0;
-
-
-	// Start playing
-	status = smk_enable_all(sf->smacker, SMK_VIDEO_TRACK);
+	status = smk_info_video(sf->smacker, &sf->width, &sf->height, nullptr);
 	Assert(status == 0);
-	sf->status = smk_first(sf->smacker);
-	for (uint8_t i = 0; i < 7; i++)
+
+	// Open a sound stream for every audio track, they are fed while the flic plays
+	unsigned char audio_tracks = 0;
+	unsigned char audio_channels[SMK_AUDIO_TRACKS];
+	unsigned char audio_depth[SMK_AUDIO_TRACKS];
+	unsigned long audio_rate[SMK_AUDIO_TRACKS];
+	if (!IsSoundEnabled() || smk_info_audio(sf->smacker, &audio_tracks, audio_channels, audio_depth, audio_rate) != 0)
+	{
+		audio_tracks = 0;
+	}
+	for (uint8_t i = 0; i < SMK_AUDIO_TRACKS; i++)
 	{
-		if (audio[i].empty() || !IsSoundEnabled())
+		if (!(audio_tracks & (1 << i)))
 		{
 			sf->sounds[i] = NO_SAMPLE;
 		}
 		else
 		{
 			ST::string name = ST::format("{}@{}", i, filename);
-			sf->sounds[i] = SoundPlayFromSmackBuff(name.c_str(), audio_channels[i], audio_depth[i], audio_rate[i], audio[i], MAXVOLUME, 64, 1, nullptr, nullptr);
+			sf->sounds[i] = SoundPlayStreamed(name.c_str(), audio_channels[i], audio_depth[i], audio_rate[i], MAXVOLUME, 64, nullptr, nullptr);
+			if (sf->sounds[i] == SOUND_ERROR) sf->sounds[i] = NO_SAMPLE;
+		}
+	}
+
+	// Start playing, the first frame is decoded right away and the decoder
+	// thread takes over from there
+	status = smk_enable_all(sf->smacker, SMK_VIDEO_TRACK | audio_tracks);
+	Assert(status == 0);
+	sf->status = smk_first(sf->smacker);
+	SmkStoreFrame(sf, sf->current);
+	SmkQueueFrameAudio(sf, sf->current);
+
+	sf->ring_head      = 0;
+	sf->ring_count     = 0;
+	sf->audio_queued   = 0;
+	sf->decoder_status = SMK_MORE;
+	sf->decoder_quit   = false;
+	if (sf->status == SMK_DONE || sf->status == SMK_ERROR)
+	{
+		sf->decoder_status = sf->status;
+	}
+	else
+	{
+		sf->decoder = SDL_CreateThread(SmkDecodeFrames, "SmkDecoderThread", sf);
+		if (sf->decoder == nullptr)
+		{
+			SLOGE("Failed to start decoding '{}': {}", filename, SDL_GetError());
+			SmkCloseFlic(sf);
+			return nullptr;
 		}
 	}
 
@@ -226,6 +338,16 @@ static SMKFLIC* SmkOpenFlic(const char* const filename)
 void SmkCloseFlic(SMKFLIC* const sf)
 {
 	Assert(sf != nullptr);
+	if (sf->decoder != nullptr)
+	{
+		{
+			std::lock_guard<std::mutex> lk(sf->mutex);
+			sf->decoder_quit = true;
+		}
+		sf->cond.notify_one();
+		SDL_WaitThread(sf->decoder, nullptr);
+		sf->decoder = nullptr;
+	}
 	FOR_EACH(UINT32, sound, sf->sounds)
 	{
 		if (*sound != NO_SAMPLE)
@@ -258,18 +380,67 @@ static SMKFLIC* SmkGetFreeFlic(void)
 }
 
 
+// Hands the audio of the frames decoded so far over to the sound streams, so
+// the sound runs ahead of the video by the decoded frames
+static void SmkQueueAudio(SMKFLIC* const sf)
+{
+	UINT32 ring_count;
+	signed char decoder_status;
+	{
+		std::lock_guard<std::mutex> lk(sf->mutex);
+		ring_count     = sf->ring_count;
+		decoder_status = sf->decoder_status;
+	}
+
+	for (; sf->audio_queued < ring_count; sf->audio_queued++)
+	{
+		SmkQueueFrameAudio(sf, sf->ring[(sf->ring_head + sf->audio_queued) % SMK_FRAMES_AHEAD]);
+	}
+
+	if (decoder_status != SMK_MORE && !(sf->flags & SMK_FLIC_AUDIO_END))
+	{
+		FOR_EACH(UINT32, sound, sf->sounds)
+		{
+			if (*sound != NO_SAMPLE) SoundStreamEnd(*sound);
+		}
+		sf->flags |= SMK_FLIC_AUDIO_END;
+	}
+}
+
+
 static void SmkSkipFrames(SMKFLIC* sf)
 {
 	// get target frame
 	UINT32 milliseconds = SDL_GetTicks() - sf->start_tick;
 	UINT32 frame_no = static_cast<UINT32>(milliseconds / sf->milliseconds_per_frame);
 
-	// skip until the target frame (video repeats if there is a ring frame)
+	// take decoded frames until the target frame (video repeats if there is a ring frame)
+	// the current frame stays on display while the decoder is behind
+	std::unique_lock<std::mutex> lk(sf->mutex);
 	while (sf->status != SMK_ERROR && sf->status != SMK_DONE && sf->frame_no != frame_no)
 	{
-		sf->status = smk_next(sf->smacker);
+		if (sf->ring_count == 0)
+		{
+			if (sf->decoder_status != SMK_MORE) sf->status = sf->decoder_status;
+			break;
+		}
+
+		std::swap(sf->current, sf->ring[sf->ring_head]);
+		sf->ring_head = (sf->ring_head + 1) % SMK_FRAMES_AHEAD;
+		sf->ring_count--;
+		if (sf->audio_queued > 0)
+		{
+			sf->audio_queued--;
+		}
+		else
+		{
+			// decoded after SmkQueueAudio() ran
+			SmkQueueFrameAudio(sf, sf->current);
+		}
 		sf->frame_no++;
 	}
+	lk.unlock();
+	sf->cond.notify_one();
 }
 
 
@@ -277,21 +448,17 @@ static void SmkBlitVideoFrame(SMKFLIC* const sf, SGPVSurface* surface)
 {
 	// get frame (source)
 	// TODO handle flags SMK_FLAG_Y_* (I need a sample of each case)
-	unsigned char* src;
-	unsigned char* src_palette;
-	unsigned long src_width;
-	unsigned long src_height;
-	src = smk_get_video(sf->smacker);
-	if (src == nullptr) return;
-	src_palette = smk_get_palette(sf->smacker);
-	if (src_palette == nullptr) return;
-	if (static_cast<signed char>(smk_info_video(sf->smacker, &src_width, &src_height, nullptr)) < 0) return;
+	if (sf->current.video.empty()) return;
+	const unsigned char* src = sf->current.video.data();
+	const unsigned char* src_palette = sf->current.palette;
+	unsigned long src_width = sf->width;
+	unsigned long src_height = sf->height;
 
 	// convert palette
 	UINT16 palette[256];
 	for (int i = 0; i < 256; i++)
 	{
-		unsigned char* rgb = src_palette + i * 3;
+		const unsigned char* rgb = src_palette + i * 3;
 		palette[i] = Get16BPPColor(FROMRGB(rgb[0], rgb[1], rgb[2]));
 	}
 
@@ -7,6 +7,7 @@
 #include "Debug.h"
 #include "Logger.h"
 
+#include <algorithm>
 #include <stdexcept>
 #include <vector>
 
@@ -76,10 +77,37 @@ static EventList& GetQueue(EventQueueID const ubQueueID)
 }
 
 
+// Every bullet of a burst queues the same noise while the attack is busy.
+// Listeners react to such a noise once, so it is only kept at the loudest
+// volume instead of being heard again for each bullet.
+static bool MergeWithDemandNoise(GAMEEVENT const& gameEvent)
+{
+	EV_S_NOISE const* const noise = std::get_if<EV_S_NOISE>(&gameEvent);
+	if (!noise) return false;
+
+	for (EVENT* const pEvent : hDemandEventQueue)
+	{
+		EV_S_NOISE* const pending = std::get_if<EV_S_NOISE>(&pEvent->gameEvent);
+		if (!pending ||
+				pending->ubNoiseMaker != noise->ubNoiseMaker ||
+				pending->sGridNo      != noise->sGridNo      ||
+				pending->bLevel       != noise->bLevel       ||
+				pending->ubNoiseType  != noise->ubNoiseType)
+		{
+			continue;
+		}
+		pending->ubVolume = std::max(pending->ubVolume, noise->ubVolume);
+		return true;
+	}
+	return false;
+}
+
+
 void AddGameEvent(GAMEEVENT const& gameEvent, UINT16 usDelay)
 {
 	if (usDelay == DEMAND_EVENT_DELAY)
 	{
+		if (MergeWithDemandNoise(gameEvent)) return;
 		AddEvent(gameEvent, 0, EventQueueID::DEMAND_EVENT_QUEUE);
 	}
 	else
@@ -327,7 +327,7 @@ enum SoundID
 template<SoundID first, SoundID last> static inline SoundID SoundRange()
 {
 	static_assert(first < last);
-	return static_cast<SoundID>(first + Random(last - first + 1));
+	return static_cast<SoundID>(first + Random(RNG_SOUND, last - first + 1));
 };
 
 
@@ -3,6 +3,7 @@
 #include "ContentManager.h"
 #include "GameInstance.h"
 #include "GamePolicy.h"
+#include "InputRecorder.h"
 
 #include <array>
 #include <utility>
@@ -60,11 +61,19 @@ extern std::uint32_t guiPotCharPathBaseTime;
 // then the game time was unfrozen.
 static ReferenceClock::time_point gLastUpdate;
 
+ReferenceClock::time_point GetReferenceTime()
+{
+	return InputRecorder::Now();
+}
+
+
 void UpdateJA2Clock()
 {
 	if (gfPauseClock) return;
 
-	auto const now{ ReferenceClock::now() };
+	auto const now{ GetReferenceTime() };
+	// The replayed time may be ahead of the real time once a replay ends
+	if (now < gLastUpdate) return;
 	guiBaseJA2Clock += static_cast<UINT32>(
 			std::chrono::duration_cast<milliseconds>(now - gLastUpdate).count());
 	gLastUpdate = now;
@@ -79,7 +88,7 @@ void InitializeJA2Clock(void)
 		RESETCOUNTER(static_cast<PredefinedCounters>(i));
 	}
 
-	gLastUpdate = ReferenceClock::now();
+	gLastUpdate = GetReferenceTime();
 	guiBaseJA2Clock = 0;
 	g_durations_multiplier = GCM->getGamePolicy()->game_durations_multiplier;
 }
@@ -92,7 +101,7 @@ void PauseTime(bool const fPaused)
 		// Remember when game time was unfrozen so that
 		// UpdateJA2Clock() can add the number of ms between
 		// this call and its own call.
-		gLastUpdate = ReferenceClock::now();
+		gLastUpdate = GetReferenceTime();
 	}
 	gfPauseClock = fPaused;
 }
@@ -151,14 +160,14 @@ bool COUNTERDONE(PredefinedCounters const pc, bool const autoReset)
 	// Timers never expire while time is paused.
 	if (gfPauseClock) return false;
 
-	bool const result{ ReferenceClock::now() >= giTimerCounters[pc] };
+	bool const result{ GetReferenceTime() >= giTimerCounters[pc] };
 	if (result && autoReset) RESETCOUNTER(pc);
 	return result;
 }
 
 void RESETTIMECOUNTER(TIMECOUNTER & tc, ReferenceClock::duration const duration)
 {
-	tc = ReferenceClock::now() + std::chrono::duration_cast
+	tc = GetReferenceTime() + std::chrono::duration_cast
 		<ReferenceClock::duration>(duration * g_durations_multiplier);
 }
 
@@ -167,7 +176,7 @@ bool TIMECOUNTERDONE(TIMECOUNTER & tc, ReferenceClock::duration const duration)
 	// Timers never expire while time is paused.
 	if (gfPauseClock) return false;
 
-	bool const result{ ReferenceClock::now() >= tc};
+	bool const result{ GetReferenceTime() >= tc};
 	if (result) RESETTIMECOUNTER(tc, duration);
 	return result;
 }
@@ -177,7 +186,13 @@ bool TIMECOUNTERDONE(TIMECOUNTER & tc, unsigned int const duration)
 	// Timers never expire while time is paused.
 	if (gfPauseClock) return false;
 
-	bool const result{ ReferenceClock::now() >= tc};
+	bool const result{ GetReferenceTime() >= tc};
 	if (result && duration != 0) RESETTIMECOUNTER(tc, milliseconds{duration});
 	return result;
 }
+
+bool TIMECOUNTERELAPSED(TIMECOUNTER const& tc)
+{
+	// Timers never expire while time is paused.
+	return !gfPauseClock && GetReferenceTime() >= tc;
+}
@@ -40,6 +40,10 @@ enum PredefinedCounters
 
 void InitializeJA2Clock(void);
 
+// The current time of the reference clock all the timers run on.  This is the
+// real time, except while an input recording is replayed.
+[[nodiscard]] ReferenceClock::time_point GetReferenceTime();
+
 void PauseTime(bool fPaused);
 
 void SetCustomizableTimerCallbackAndDelay(ReferenceClock::duration, CUSTOMIZABLE_TIMER_CALLBACK, bool fReplace);
@@ -64,6 +68,8 @@ void RESETCOUNTER(PredefinedCounters);
 // As above, except that you can specify millis == 0 if you do not want to
 // automatically reset the counter.
 [[nodiscard]] bool TIMECOUNTERDONE(TIMECOUNTER &, unsigned int millis);
+// Test if the given counter has elapsed, without resetting it.
+[[nodiscard]] bool TIMECOUNTERELAPSED(TIMECOUNTER const&);
 
 
 void RESETTIMECOUNTER(TIMECOUNTER &, ReferenceClock::duration);
@@ -73,7 +79,7 @@ static inline void RESETTIMECOUNTER(TIMECOUNTER & tc, unsigned int const millis)
 {
 	RESETTIMECOUNTER(tc, milliseconds{millis});
 }
-static inline void ZEROTIMECOUNTER(TIMECOUNTER & tc) { tc = ReferenceClock::now(); }
+static inline void ZEROTIMECOUNTER(TIMECOUNTER & tc) { tc = GetReferenceTime(); }
 
 // whenever guiBaseJA2Clock changes, we must reset all the timer variables that
 // use it as a reference
@@ -17,7 +17,9 @@ try
 	Launcher launcher(argc, argv);
 	launcher.loadJa2Json();
 	launcher.show();
-	return Fl::run();
+	int const result = Fl::run();
+	Logger_flush();
+	return result;
 }
 catch (...)
 {
@@ -0,0 +1,382 @@
+#include "InputRecorder.h"
+#include "FileMan.h"
+#include "Logger.h"
+#include "Random.h"
+#include "SGP.h"
+
+#include <SDL_timer.h>
+#include <string_theory/format>
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <string.h>
+#include <string>
+
+
+namespace InputRecorder
+{
+
+// The events are stored as raw SDL_Event structures, so a recording can only
+// be played back by a build for the same platform and SDL version.
+static char     const RECORDING_MAGIC[4] = { 'J', 'A', 'I', 'R' };
+static uint32_t const RECORDING_VERSION  = 3;
+
+enum RecordType : uint8_t
+{
+	RECORD_EVENT,
+	RECORD_FILE,
+	RECORD_TIME,
+	RECORD_END
+};
+
+struct Record
+{
+	RecordType           type;
+	uint32_t             frame;
+	SDL_Event            event;
+	int64_t              time; // microseconds since the start of the run
+	std::vector<uint8_t> data;
+};
+
+enum Mode
+{
+	MODE_OFF,
+	MODE_RECORDING,
+	MODE_REPLAYING
+};
+
+static Mode        gMode      = MODE_OFF;
+static bool        gfMaxSpeed = false;
+static uint32_t    guiFrame   = 0;
+static AutoSGPFile gRecording;
+
+static std::vector<Record> gReplay;
+static size_t              guiNextEvent = 0;
+static size_t              guiNextFile  = 0;
+static size_t              guiNextTime  = 0;
+static uint32_t            guiLastFrame = 0;
+
+static Clock::time_point gFrameTime;
+static uint32_t          guiRunStartTicks = 0;
+
+static std::vector<Clock::duration>            gFrameTimes;
+static std::map<std::string, Clock::duration> gSubsystemTimes;
+static Clock::time_point                       gRunStart;
+
+
+template<typename T> static void Write(T const& value)
+{
+	gRecording->write(&value, sizeof(value));
+}
+
+
+static void WriteRecordHeader(RecordType const type)
+{
+	Write(type);
+	Write(guiFrame);
+}
+
+
+static int64_t SinceRunStart(Clock::time_point const t)
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(t - gRunStart).count();
+}
+
+
+// Fixes the time of the frame which is about to start
+static void StartFrame()
+{
+	switch (gMode)
+	{
+		case MODE_RECORDING:
+			gFrameTime = Clock::now();
+			WriteRecordHeader(RECORD_TIME);
+			Write(SinceRunStart(gFrameTime));
+			break;
+
+		case MODE_REPLAYING:
+			while (guiNextTime != gReplay.size())
+			{
+				Record const& r = gReplay[guiNextTime];
+				if (r.frame > guiFrame) break;
+				++guiNextTime;
+				if (r.type != RECORD_TIME) continue;
+				gFrameTime = gRunStart + std::chrono::microseconds(r.time);
+			}
+			break;
+
+		case MODE_OFF:
+			break;
+	}
+}
+
+
+template<typename T> static T Read(std::vector<uint8_t> const& buf, size_t& pos)
+{
+	T value;
+	if (buf.size() - pos < sizeof(value)) throw std::runtime_error("input recording is truncated");
+	memcpy(&value, &buf[pos], sizeof(value));
+	pos += sizeof(value);
+	return value;
+}
+
+
+void StartRecording(ST::string const& filename)
+{
+	gRecording = FileMan::openForWriting(filename);
+	gRecording->write(RECORDING_MAGIC, sizeof(RECORDING_MAGIC));
+	Write(RECORDING_VERSION);
+	UINT32 seed1, seed2;
+	GetRandomSeed(seed1, seed2);
+	Write(seed1);
+	Write(seed2);
+
+	gMode            = MODE_RECORDING;
+	guiFrame         = 0;
+	gRunStart        = Clock::now();
+	guiRunStartTicks = SDL_GetTicks();
+	StartFrame();
+	SLOGI("Recording input to '{}'", filename);
+}
+
+
+void StartReplay(ST::string const& filename, bool const fMaxSpeed)
+{
+	std::vector<uint8_t> buf;
+	{
+		AutoSGPFile f(FileMan::openForReading(filename));
+		buf = f->readToEnd();
+	}
+
+	size_t pos = sizeof(RECORDING_MAGIC);
+	if (buf.size() < pos || memcmp(buf.data(), RECORDING_MAGIC, pos) != 0)
+	{
+		throw std::runtime_error(ST::format("'{}' is not an input recording", filename).to_std_string());
+	}
+	if (Read<uint32_t>(buf, pos) != RECORDING_VERSION)
+	{
+		throw std::runtime_error(ST::format("input recording '{}' has an unsupported version", filename).to_std_string());
+	}
+	uint32_t const seed1 = Read<uint32_t>(buf, pos);
+	uint32_t const seed2 = Read<uint32_t>(buf, pos);
+	SeedRandom(seed1, seed2);
+
+	gReplay.clear();
+	for (;;)
+	{
+		if (pos == buf.size())
+		{ // The recording session did not end normally, play back what is there
+			guiLastFrame = gReplay.empty() ? 0 : gReplay.back().frame + 1;
+			break;
+		}
+
+		Record r;
+		r.type  = Read<RecordType>(buf, pos);
+		r.frame = Read<uint32_t>(buf, pos);
+		if (r.type == RECORD_END)
+		{
+			guiLastFrame = r.frame;
+			break;
+		}
+		switch (r.type)
+		{
+			case RECORD_EVENT:
+				r.event = Read<SDL_Event>(buf, pos);
+				break;
+
+			case RECORD_TIME:
+				r.time = Read<int64_t>(buf, pos);
+				break;
+
+			case RECORD_FILE:
+			{
+				uint32_t const size = Read<uint32_t>(buf, pos);
+				if (buf.size() - pos < size) throw std::runtime_error("input recording is truncated");
+				r.data.assign(buf.begin() + pos, buf.begin() + pos + size);
+				pos += size;
+				break;
+			}
+
+			default:
+				throw std::runtime_error(ST::format("input recording '{}' is corrupt", filename).to_std_string());
+		}
+		gReplay.push_back(std::move(r));
+	}
+
+	gMode            = MODE_REPLAYING;
+	gfMaxSpeed       = fMaxSpeed;
+	guiFrame         = 0;
+	guiNextEvent     = 0;
+	guiNextFile      = 0;
+	guiNextTime      = 0;
+	gRunStart        = Clock::now();
+	guiRunStartTicks = SDL_GetTicks();
+	gFrameTime       = gRunStart;
+	StartFrame();
+	SLOGI("Replaying {} frames of input from '{}'", guiLastFrame, filename);
+}
+
+
+bool IsRecording()
+{
+	return gMode == MODE_RECORDING;
+}
+
+
+bool IsReplaying()
+{
+	return gMode == MODE_REPLAYING;
+}
+
+
+bool IsFrameRateUncapped()
+{
+	return gMode == MODE_REPLAYING && gfMaxSpeed;
+}
+
+
+void RecordEvent(SDL_Event const& event)
+{
+	if (gMode != MODE_RECORDING) return;
+	WriteRecordHeader(RECORD_EVENT);
+	Write(event);
+}
+
+
+bool NextEvent(SDL_Event& event)
+{
+	if (gMode != MODE_REPLAYING) return false;
+	while (guiNextEvent != gReplay.size())
+	{
+		Record const& r = gReplay[guiNextEvent];
+		if (r.frame > guiFrame) return false;
+		++guiNextEvent;
+		if (r.type != RECORD_EVENT) continue;
+		event = r.event;
+		return true;
+	}
+	return false;
+}
+
+
+void EndFrame(Clock::duration const elapsed)
+{
+	if (gMode == MODE_OFF) return;
+	gFrameTimes.push_back(elapsed);
+	++guiFrame;
+
+	if (gMode == MODE_REPLAYING && guiFrame >= guiLastFrame)
+	{
+		Finish();
+		requestGameExit();
+		return;
+	}
+	StartFrame();
+}
+
+
+Clock::time_point Now()
+{
+	return gMode == MODE_OFF ? Clock::now() : gFrameTime;
+}
+
+
+uint32_t GetTicks()
+{
+	if (gMode == MODE_OFF) return SDL_GetTicks();
+	return guiRunStartTicks + static_cast<uint32_t>(SinceRunStart(gFrameTime) / 1000);
+}
+
+
+void RecordLoadedFile(std::vector<uint8_t> const& data)
+{
+	if (gMode != MODE_RECORDING) return;
+	WriteRecordHeader(RECORD_FILE);
+	Write(static_cast<uint32_t>(data.size()));
+	gRecording->write(data.data(), data.size());
+}
+
+
+bool ReplayLoadedFile(std::vector<uint8_t>& data)
+{
+	if (gMode != MODE_REPLAYING) return false;
+	while (guiNextFile != gReplay.size())
+	{
+		Record const& r = gReplay[guiNextFile++];
+		if (r.type != RECORD_FILE) continue;
+		data = r.data;
+		return true;
+	}
+	return false;
+}
+
+
+void AddSubsystemTime(char const* const name, Clock::duration const elapsed)
+{
+	gSubsystemTimes[name] += elapsed;
+}
+
+
+static double ToMillis(Clock::duration const d)
+{
+	return std::chrono::duration<double, std::milli>(d).count();
+}
+
+
+static void LogRunSummary()
+{
+	size_t const n = gFrameTimes.size();
+	double const total = ToMillis(Clock::now() - gRunStart);
+	SLOGI("Run summary: {} frames in {.1f} ms", n, total);
+	if (n == 0) return;
+
+	std::vector<Clock::duration> sorted = gFrameTimes;
+	std::sort(sorted.begin(), sorted.end());
+	auto percentile = [&](size_t const p) { return ToMillis(sorted[(n - 1) * p / 100]); };
+	SLOGI("Frame times: p50 {.3f} ms, p90 {.3f} ms, p99 {.3f} ms, max {.3f} ms",
+		percentile(50), percentile(90), percentile(99), ToMillis(sorted.back()));
+
+	for (auto const& i : gSubsystemTimes)
+	{
+		double const ms = ToMillis(i.second);
+		SLOGI("{}: {.1f} ms total, {.3f} ms per frame", i.first, ms, ms / n);
+	}
+}
+
+
+void Finish()
+{
+	switch (gMode)
+	{
+		case MODE_RECORDING:
+			WriteRecordHeader(RECORD_END);
+			gRecording.Deallocate();
+			SLOGI("Recorded {} frames of input", guiFrame);
+			break;
+
+		case MODE_REPLAYING:
+			gReplay.clear();
+			break;
+
+		case MODE_OFF:
+			return;
+	}
+	LogRunSummary();
+	gMode = MODE_OFF;
+}
+
+
+SubsystemTimer::SubsystemTimer(char const* const name) :
+	m_name(gMode != MODE_OFF ? name : nullptr)
+{
+	if (m_name) m_start = Clock::now();
+}
+
+
+SubsystemTimer::~SubsystemTimer()
+{
+	if (m_name) AddSubsystemTime(m_name, Clock::now() - m_start);
+}
+
+}
@@ -0,0 +1,73 @@
+#ifndef INPUT_RECORDER_H
+#define INPUT_RECORDER_H
+
+#include <SDL_events.h>
+#include <chrono>
+#include <stdint.h>
+#include <string_theory/string>
+#include <vector>
+
+// Records the SDL input events of a session together with the game loop frame
+// they were handled in, and plays them back in a later session.  The random
+// seed, the time of every frame and the save games loaded during the recording
+// are stored along with the events, so the replay starts out from the same
+// state and its timers expire in the same frames.  A replay either
+// runs at the normal frame rate or, for benchmarks, as fast as possible, and
+// ends with a run summary of the frame times and the time spent per subsystem.
+namespace InputRecorder
+{
+	using Clock = std::chrono::steady_clock;
+
+	void StartRecording(ST::string const& filename);
+	void StartReplay(ST::string const& filename, bool fMaxSpeed);
+
+	bool IsRecording();
+	bool IsReplaying();
+
+	// The frame rate is not limited while replaying at maximum speed
+	bool IsFrameRateUncapped();
+
+	// Recording: remember an event handled before the next frame
+	void RecordEvent(SDL_Event const&);
+
+	// Replay: fetch the next event to handle before the next frame, returns
+	// false once all events of this frame have been handed out
+	bool NextEvent(SDL_Event&);
+
+	// Call after every game loop with the time it took
+	void EndFrame(Clock::duration);
+
+	// The time the game timers run on.  While recording or replaying it only
+	// advances between frames, and during a replay it is the recorded time of
+	// the frame instead of the real time.
+	Clock::time_point Now();
+	// As above, in milliseconds like SDL_GetTicks()
+	uint32_t GetTicks();
+
+	// Recording: embed the contents of a save game which is being loaded.
+	// Replay: fetch the contents which were embedded at this point, returns
+	// false if there are none.
+	void RecordLoadedFile(std::vector<uint8_t> const& data);
+	bool ReplayLoadedFile(std::vector<uint8_t>& data);
+
+	// Adds to the time spent in a subsystem during this run
+	void AddSubsystemTime(char const* name, Clock::duration);
+
+	// Writes the end of the recording or logs the run summary of the replay
+	void Finish();
+
+	// Measures the time spent in a subsystem until the end of the scope, only
+	// while recording or replaying
+	class SubsystemTimer
+	{
+		public:
+			SubsystemTimer(char const* name);
+			~SubsystemTimer();
+
+		private:
+			char const*       m_name;
+			Clock::time_point m_start;
+	};
+}
+
+#endif
@@ -0,0 +1,29 @@
+#include "Logger.h"
+
+#include <chrono>
+
+
+bool LogCallSite::admit(uint32_t const now, uint32_t& suppressed)
+{
+	uint32_t start = m_windowStart.load(std::memory_order_relaxed);
+	if (now - start >= 1000 && m_windowStart.compare_exchange_strong(start, now, std::memory_order_relaxed))
+	{
+		m_count.store(0, std::memory_order_relaxed);
+	}
+
+	if (m_count.fetch_add(1, std::memory_order_relaxed) >= LOG_CALL_SITE_LIMIT)
+	{
+		m_suppressed.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	suppressed = m_suppressed.exchange(0, std::memory_order_relaxed);
+	return true;
+}
+
+
+uint32_t GetLogClock()
+{
+	using namespace std::chrono;
+	return static_cast<uint32_t>(duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count());
+}
@@ -3,6 +3,8 @@
 
 #include "Platform.h"
 #include "RustInterface.h"
+#include <atomic>
+#include <cstdint>
 #include <string_view>
 #include <string_theory/format>
 #include <string_theory/string>
@@ -27,34 +29,63 @@ template <size_t p> constexpr const char* ToRelativePath(const char* filename)
 #define SOURCE_PATH_SIZE (GetSourcePathSize(__FILE__))
 #define __FILENAME__ (ToRelativePath<SOURCE_PATH_SIZE>(__FILE__))
 
+/** Number of messages a single log statement may write per second.
+ * Errors and assertions are never dropped. */
+#define LOG_CALL_SITE_LIMIT 50
+
+/** Per log statement state to keep a single statement from flooding the log */
+class LogCallSite
+{
+public:
+	/** Returns whether a message may be written at time `now` (milliseconds).
+	 * If so, `suppressed` is the number of messages dropped since the last one. */
+	bool admit(uint32_t now, uint32_t& suppressed);
+
+private:
+	std::atomic<uint32_t> m_windowStart{0};
+	std::atomic<uint32_t> m_count{0};
+	std::atomic<uint32_t> m_suppressed{0};
+};
+
+/** Milliseconds since an arbitrary point, used for rate limiting */
+uint32_t GetLogClock();
+
 template<typename... Args>
-constexpr void LogMessageST([[maybe_unused]] bool isAssert, LogLevel level, const char* file, Args && ... args)
+constexpr void LogMessageST([[maybe_unused]] bool isAssert, LogLevel level, const char* file, LogCallSite& site, Args && ... args)
 {
-	if (level <= Logger_getLevel()) {
-		Logger_log(level, ST::format(std::forward<Args>(args)...).c_str(), file);
+	uint32_t suppressed = 0;
+	if (level <= Logger_getLevel() &&
+		(level == LogLevel::Error || isAssert || site.admit(GetLogClock(), suppressed))) {
+		ST::string msg = ST::format(std::forward<Args>(args)...);
+		if (suppressed != 0) msg += ST::format(" ({} similar messages suppressed)", suppressed);
+		Logger_log(level, msg.c_str(), file);
 	}
 
 	#ifdef ENABLE_ASSERTS
 	if (isAssert)
 	{
+		Logger_flush();
 		abort();
 	}
 	#endif
 }
 
+/** Each expansion of the log macros gets its own call site state */
+#define LOG_CALL_SITE ([]() -> LogCallSite& { static LogCallSite site; return site; }())
+
 /** Print debug message macro. */
-#define SLOGD(...) LogMessageST(false, LogLevel::Debug, __FILENAME__, ##__VA_ARGS__)
+#define SLOGD(...) LogMessageST(false, LogLevel::Debug, __FILENAME__, LOG_CALL_SITE, ##__VA_ARGS__)
 
 /** Print info message macro. */
-#define SLOGI(...) LogMessageST(false, LogLevel::Info,  __FILENAME__, ##__VA_ARGS__)
+#define SLOGI(...) LogMessageST(false, LogLevel::Info,  __FILENAME__, LOG_CALL_SITE, ##__VA_ARGS__)
 
 /** Print warning message macro. */
-#define SLOGW(...) LogMessageST(false, LogLevel::Warn, __FILENAME__, ##__VA_ARGS__)
+#define SLOGW(...) LogMessageST(false, LogLevel::Warn, __FILENAME__, LOG_CALL_SITE, ##__VA_ARGS__)
 
 /** Print error message macro. */
-#define SLOGE(...) LogMessageST(false, LogLevel::Error, __FILENAME__, ##__VA_ARGS__)
+#define SLOGE(...) LogMessageST(false, LogLevel::Error, __FILENAME__, LOG_CALL_SITE, ##__VA_ARGS__)
 
 /** Print error message macro and assert if ENABLE_ASSERTS is defined. */
-#define SLOGA(...) LogMessageST(true, LogLevel::Error, __FILENAME__, ##__VA_ARGS__)
+#define SLOGA(...) LogMessageST(true, LogLevel::Error, __FILENAME__, LOG_CALL_SITE, ##__VA_ARGS__)
 
 #endif//SGP_LOGGER_H_
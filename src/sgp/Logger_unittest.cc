@@ -22,4 +22,23 @@ TEST(Logger, sourcePathLength)
 #endif
 }
 
+TEST(Logger, callSiteLimit)
+{
+	LogCallSite site;
+	uint32_t suppressed = 0;
+	for (int i = 0; i < LOG_CALL_SITE_LIMIT; ++i)
+	{
+		EXPECT_TRUE(site.admit(5000, suppressed));
+		EXPECT_EQ(suppressed, 0u);
+	}
+	EXPECT_FALSE(site.admit(5500, suppressed));
+	EXPECT_FALSE(site.admit(5999, suppressed));
+
+	// a new window starts a second later and reports what was dropped
+	EXPECT_TRUE(site.admit(6000, suppressed));
+	EXPECT_EQ(suppressed, 2u);
+	EXPECT_TRUE(site.admit(6001, suppressed));
+	EXPECT_EQ(suppressed, 0u);
+}
+
 #undef EXPECTED_FILENAME
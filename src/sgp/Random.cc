@@ -1,6 +1,8 @@
 #include "Random.h"
 
+#include <algorithm>
 #include <chrono>
+#include <iterator>
 #include <random>
 
 /// Pseudo-random number engine.
@@ -36,6 +38,11 @@ struct PreRandomEngine {
 };
 static PreRandomEngine gPreRandomEngine;
 
+/// Per subsystem streams.
+static RandomStream gRandomStreams[NUM_RANDOM_STREAMS];
+static UINT32       guiRandomSeeds[2] = { 0, 0 };
+
+
 void InitializeRandom(void)
 {
 	// Seed the pseudo-random number engine with the current time
@@ -47,6 +54,15 @@ void InitializeRandom(void)
 	std::random_device randomDevice;
 	UINT32 uiSeed2 = guiDistribution(randomDevice);
 
+	SeedRandom(uiSeed1, uiSeed2);
+}
+
+
+void SeedRandom(UINT32 const uiSeed1, UINT32 const uiSeed2)
+{
+	guiRandomSeeds[0] = uiSeed1;
+	guiRandomSeeds[1] = uiSeed2;
+
 	std::seed_seq seed = { uiSeed1, uiSeed2 };
 	gRandomEngine.seed(seed);
 
@@ -56,6 +72,39 @@ void InitializeRandom(void)
 		guiPreRandomNums[ guiPreRandomIndex ] = guiDistribution(gRandomEngine);
 	}
 	guiPreRandomIndex = 0;
+
+	for (UINT32 i = 0; i != NUM_RANDOM_STREAMS; ++i)
+	{
+		std::seed_seq stream_seed = { uiSeed1, uiSeed2, i };
+		UINT32 s[2];
+		stream_seed.generate(std::begin(s), std::end(s));
+		gRandomStreams[i].seed((uint64_t)s[0] << 32 | s[1]);
+	}
+}
+
+
+void GetRandomSeed(UINT32& uiSeed1, UINT32& uiSeed2)
+{
+	uiSeed1 = guiRandomSeeds[0];
+	uiSeed2 = guiRandomSeeds[1];
+}
+
+
+void SaveRandomState(RandomState& state)
+{
+	state.engine           = gRandomEngine;
+	state.uiPreRandomIndex = guiPreRandomIndex;
+	std::copy(std::begin(guiPreRandomNums), std::end(guiPreRandomNums), state.uiPreRandomNums);
+	std::copy(std::begin(gRandomStreams),   std::end(gRandomStreams),   state.streams);
+}
+
+
+void RestoreRandomState(RandomState const& state)
+{
+	gRandomEngine     = state.engine;
+	guiPreRandomIndex = state.uiPreRandomIndex;
+	std::copy(std::begin(state.uiPreRandomNums), std::end(state.uiPreRandomNums), guiPreRandomNums);
+	std::copy(std::begin(state.streams),         std::end(state.streams),         gRandomStreams);
 }
 
 /// Returns a pseudo-random integer in the range [0,uiRange).
@@ -95,3 +144,66 @@ bool CoinToss()
 
 	return Jacob(gRandomEngine);
 }
+
+
+static inline UINT32 RotateLeft(UINT32 const x, int const k)
+{
+	return x << k | x >> (32 - k);
+}
+
+
+void RandomStream::seed(uint64_t seed)
+{
+	// Expand the seed with splitmix64, which never yields an all zero state
+	for (UINT32 i = 0; i != 4; i += 2)
+	{
+		uint64_t z = (seed += 0x9E3779B97F4A7C15ULL);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		z ^= z >> 31;
+		m_state[i]     = (UINT32)z;
+		m_state[i + 1] = (UINT32)(z >> 32);
+	}
+}
+
+
+RandomStream::result_type RandomStream::operator()()
+{
+	UINT32* const s = m_state;
+	UINT32 const result = RotateLeft(s[1] * 5, 7) * 9;
+	UINT32 const t = s[1] << 9;
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = RotateLeft(s[3], 11);
+	return result;
+}
+
+
+bool RandomStream::operator==(RandomStream const& o) const
+{
+	return std::equal(std::begin(m_state), std::end(m_state), std::begin(o.m_state));
+}
+
+
+RandomStream& GetRandomStream(RandomStreamID const id)
+{
+	return gRandomStreams[id];
+}
+
+
+UINT32 Random(RandomStreamID const id, UINT32 const uiRange)
+{
+	if (!uiRange)
+		return 0;
+	std::uniform_int_distribution<UINT32> distribution(0, uiRange - 1);
+	return distribution(gRandomStreams[id]);
+}
+
+
+BOOLEAN Chance(RandomStreamID const id, UINT32 const uiChance)
+{
+	return Random(id, 100) < uiChance;
+}
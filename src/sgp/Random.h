@@ -2,6 +2,7 @@
 #define __RANDOM_
 
 #include "Types.h"
+#include <cstdint>
 #include <random>
 
 
@@ -27,4 +28,59 @@ extern UINT32 guiPreRandomNums[ MAX_PREGENERATED_NUMS ];
 
 extern std::mt19937 gRandomEngine;
 
+
+// Subsystems which draw from their own random number stream, so their numbers
+// do not depend on how much randomness the rest of the game used up.  A stream
+// must only be used by one thread at a time.
+enum RandomStreamID
+{
+	RNG_AI,
+	RNG_SOUND,
+	NUM_RANDOM_STREAMS
+};
+
+/// xoshiro128** pseudo-random number engine, small and fast to copy.
+class RandomStream
+{
+public:
+	typedef UINT32 result_type;
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return UINT32_MAX; }
+
+	void seed(uint64_t seed);
+	result_type operator()();
+
+	bool operator==(RandomStream const& o) const;
+
+private:
+	UINT32 m_state[4];
+};
+
+// Returns a pseudo-random integer in the range [0,uiRange) from the given stream.
+UINT32 Random(RandomStreamID, UINT32 uiRange);
+BOOLEAN Chance(RandomStreamID, UINT32 uiChance);
+
+RandomStream& GetRandomStream(RandomStreamID);
+
+
+// Everything needed to reproduce the following random numbers bit by bit
+struct RandomState
+{
+	std::mt19937 engine;
+	UINT32       uiPreRandomIndex;
+	UINT32       uiPreRandomNums[MAX_PREGENERATED_NUMS];
+	RandomStream streams[NUM_RANDOM_STREAMS];
+};
+
+// Reseed the engine, the pregenerated numbers and all streams from two seeds,
+// like InitializeRandom() does with the time and the random device.  Every
+// stream gets its own seed derived from them.
+void SeedRandom(UINT32 uiSeed1, UINT32 uiSeed2 = 0);
+
+// The seeds given to the last SeedRandom() call
+void GetRandomSeed(UINT32& uiSeed1, UINT32& uiSeed2);
+
+void SaveRandomState(RandomState&);
+void RestoreRandomState(RandomState const&);
+
 #endif
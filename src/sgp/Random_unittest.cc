@@ -0,0 +1,56 @@
+#include "gtest/gtest.h"
+
+#include "Random.h"
+
+
+TEST(Random, sameSeedSameNumbers)
+{
+	SeedRandom(1234);
+	UINT32 const a = Random(1000), b = PreRandom(1000), c = Random(RNG_AI, 1000);
+
+	SeedRandom(1234);
+	UINT32 seed1, seed2;
+	GetRandomSeed(seed1, seed2);
+	EXPECT_EQ(seed1, 1234u);
+	EXPECT_EQ(seed2, 0u);
+	EXPECT_EQ(Random(1000), a);
+	EXPECT_EQ(PreRandom(1000), b);
+	EXPECT_EQ(Random(RNG_AI, 1000), c);
+}
+
+
+TEST(Random, streamsAreIndependent)
+{
+	SeedRandom(42);
+	UINT32 expected[16];
+	for (UINT32& n : expected) n = Random(RNG_AI, UINT32_MAX);
+
+	SeedRandom(42);
+	for (int i = 0; i != 100; ++i)
+	{
+		Random(RNG_SOUND, 10);
+		Random(10);
+		PreRandom(10);
+	}
+	for (UINT32 const n : expected) EXPECT_EQ(Random(RNG_AI, UINT32_MAX), n);
+
+	EXPECT_FALSE(GetRandomStream(RNG_AI) == GetRandomStream(RNG_SOUND));
+}
+
+
+TEST(Random, restoreState)
+{
+	SeedRandom(7);
+	Random(RNG_SOUND, 10);
+	PreRandom(10);
+
+	RandomState state;
+	SaveRandomState(state);
+	UINT32 const a = Random(1000), b = PreRandom(1000), c = Random(RNG_SOUND, 1000);
+
+	Random(1000);
+	RestoreRandomState(state);
+	EXPECT_EQ(Random(1000), a);
+	EXPECT_EQ(PreRandom(1000), b);
+	EXPECT_EQ(Random(RNG_SOUND, 1000), c);
+}
@@ -4,6 +4,7 @@
 #include "GameLoop.h"
 #include "GameSettings.h"
 #include "Input.h"
+#include "InputRecorder.h"
 #include "Intro.h"
 #include "JA2_Splash.h"
 #include "Random.h"
@@ -86,8 +87,12 @@ static void shutdownGame()
 	SLOGD("Shutting Down Video Manager");
 	ShutdownVideoManager();
 
+	InputRecorder::Finish();
+
 	SLOGD("Shutting Down SDL");
 	SDL_Quit();
+
+	Logger_flush();
 }
 
 /** Deinitialize the game an exit. */
@@ -113,6 +118,49 @@ void requestGameExit()
 	SDL_PushEvent(&event);
 }
 
+static bool IsInputEvent(SDL_Event const& event)
+{
+	switch (event.type)
+	{
+		case SDL_KEYDOWN:
+		case SDL_KEYUP:
+		case SDL_TEXTINPUT:
+		case SDL_MOUSEBUTTONDOWN:
+		case SDL_MOUSEBUTTONUP:
+		case SDL_MOUSEMOTION:
+		case SDL_MOUSEWHEEL:
+		case SDL_FINGERMOTION:
+		case SDL_FINGERUP:
+		case SDL_FINGERDOWN:
+			return true;
+
+		default:
+			return false;
+	}
+}
+
+
+/* Like SDL_PollEvent(), but input events are recorded while recording and
+ * replaced by the recorded ones while replaying. */
+static bool PollEvent(SDL_Event& event)
+{
+	if (!InputRecorder::IsReplaying())
+	{
+		if (!SDL_PollEvent(&event)) return false;
+		if (IsInputEvent(event)) InputRecorder::RecordEvent(event);
+		return true;
+	}
+
+	if (InputRecorder::NextEvent(event)) return true;
+	while (SDL_PollEvent(&event))
+	{
+		// Live input is ignored, but the window must stay responsive
+		if (!IsInputEvent(event)) return true;
+	}
+	return false;
+}
+
+
 static void MainLoop()
 {
 	bool s_doGameCycles{true};
@@ -124,7 +172,7 @@ static void MainLoop()
 		UpdateJA2Clock();
 
 		SDL_Event event;
-		if (SDL_PollEvent(&event))
+		if (PollEvent(event))
 		{
 			switch (event.type)
 			{
@@ -137,8 +185,9 @@ static void MainLoop()
 					break;
 
 				case SDL_KEYDOWN:
+					// The modifiers of the event itself, they are replayed with it
 					if (event.key.keysym.sym == SDLK_f &&
-					    SDL_GetModState() & KMOD_CTRL)
+					    event.key.keysym.mod & KMOD_CTRL)
 					{
 						FPS::ToggleOnOff();
 					}
@@ -175,9 +224,13 @@ static void MainLoop()
 				constexpr auto targetResolution = 1'000'000us / 144;
 				auto const beforeGameLoop = std::chrono::steady_clock::now();
 				FPS::GameLoopPtr();
+				InputRecorder::EndFrame(std::chrono::steady_clock::now() - beforeGameLoop);
 
 				// If the game loop took longer than 6944ms, this call does nothing.
-				std::this_thread::sleep_until(beforeGameLoop + targetResolution);
+				if (!InputRecorder::IsFrameRateUncapped())
+				{
+					std::this_thread::sleep_until(beforeGameLoop + targetResolution);
+				}
 			}
 			else
 			{
@@ -327,6 +380,10 @@ int main(int argc, char* argv[])
 			SoundEnableSound(FALSE);
 		}
 
+		RustPointer<char> recordInputFile(EngineOptions_getRecordInputFile(params.get()));
+		RustPointer<char> replayInputFile(EngineOptions_getReplayInputFile(params.get()));
+		bool const replayAtMaxSpeed = EngineOptions_shouldReplayAtMaxSpeed(params.get());
+
 		if (EngineOptions_shouldStartInDebugMode(params.get())) {
 			Logger_setLevel(LogLevel::Debug);
 			GameMode::getInstance()->setDebugging(true);
@@ -416,6 +473,15 @@ int main(int argc, char* argv[])
 		// Initialize random number generator
 		InitializeRandom(); // no Shutdown
 
+		if (*replayInputFile) {
+			if (*recordInputFile) {
+				SLOGW("Cannot record input while replaying it, not recording");
+			}
+			InputRecorder::StartReplay(replayInputFile.get(), replayAtMaxSpeed);
+		} else if (*recordInputFile) {
+			InputRecorder::StartRecording(recordInputFile.get());
+		}
+
 		SLOGD("Initializing Game Manager");
 		// Initialize the Game
 		InitializeGame();
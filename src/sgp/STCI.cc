@@ -18,7 +18,12 @@ static SGPImage* STCILoadRGB(    UINT16 contents, HWFILE, STCIHeader const*);
 SGPImage* LoadSTCIFileToImage(const ST::string& filename, UINT16 const fContents)
 {
 	AutoSGPFile f(GCM->openGameResForReading(filename));
+	return LoadSTCIFileToImage(f, fContents);
+}
+
 
+SGPImage* LoadSTCIFileToImage(HWFILE const f, UINT16 const fContents)
+{
 	STCIHeader header;
 	f->read(&header, sizeof(header));
 	if (memcmp(header.cID, STCI_ID_STRING, STCI_ID_LEN) != 0)
@@ -6,4 +6,8 @@
 
 SGPImage* LoadSTCIFileToImage(const ST::string& filename, UINT16 fContents);
 
+/* Read an image from an already opened file.  Does not use the content
+ * manager, so it may be called from a worker thread. */
+SGPImage* LoadSTCIFileToImage(HWFILE, UINT16 fContents);
+
 #endif
@@ -94,6 +94,17 @@ enum
 // Buffer size for a single channel in the sound system
 #define SOUND_RING_BUFFER_SIZE (128 * SOUND_SAMPLES)
 
+// PCM data of a streamed sample that has been queued by its producer but not
+// yet converted into the ring buffer of the playing channel.
+// The main thread appends to it, the buffer service thread consumes it.
+struct SOUNDSTREAM
+{
+	std::mutex         mutex;
+	std::vector<UINT8> data;      // queued data in the format of the sample
+	size_t             uiReadPos; // offset of the first byte not yet consumed
+	BOOLEAN            fEnded;    // the producer will not queue any more data
+};
+
 // Struct definition for sample slots in the cache
 // Holds the regular sample data, as well as the data for the random samples
 struct SAMPLETAG
@@ -111,6 +122,8 @@ struct SAMPLETAG
 	SDL_RWops* pRWOps; // RWOps on either pData or pSource
 	ma_decoder* pDecoder; // pointer to a decoder that decodes the data from the SDL_RWops
 
+	SOUNDSTREAM* pStream; // pointer to the queued data (if playing from a stream fed while playing)
+
 	UINT32  uiFlags;     // Status flags
 	UINT32  uiCacheHits;
 
@@ -237,15 +250,16 @@ static SAMPLETAG* SoundLoadBuffer(UINT8* buf, UINT32 bufSize, ma_format format,
 static BOOLEAN    SoundCleanCache(void);
 static SAMPLETAG* SoundGetEmptySample(void);
 
-/* Play a sound sample from a Smacker Flick
+/* Play a sound sample that is fed while playing, e.g. from a Smacker Flick
  *
- * Allocates space for the sound sample within the sound system
+ * Allocates a sample slot without any data, the data is queued with
+ * SoundStreamQueue()
  */
-UINT32 SoundPlayFromSmackBuff(const char* name, UINT8 channels, UINT8 depth, UINT32 rate, std::vector<UINT8>& buf, UINT32 volume, UINT32 pan, UINT32 loop, void (*end_callback)(void*), void* data)
+UINT32 SoundPlayStreamed(const char* name, UINT8 channels, UINT8 depth, UINT32 rate, UINT32 volume, UINT32 pan, void (*end_callback)(void*), void* data)
 {
 	ma_format format;
 
-	if (buf.empty()) return SOUND_ERROR;
+	if (!fSoundSystemInit) return SOUND_ERROR;
 
 	//Originaly Sound Blaster could only play mono unsigned 8-bit PCM data.
 	//Later it became capable of playing 16-bit audio data, but needed to be signed and LSB.
@@ -254,17 +268,10 @@ UINT32 SoundPlayFromSmackBuff(const char* name, UINT8 channels, UINT8 depth, UIN
 	else if (depth == 16) format = ma_format_s16;
 	else return SOUND_ERROR;
 
-	UINT32 uiBufferSize = buf.size();
-	UINT8* inMemoryBuffer = new UINT8[uiBufferSize]{};
-	memcpy(inMemoryBuffer, buf.data(), uiBufferSize);
-	if (format == ma_format_s16) {
-		// We expect the Endianess for the Smacker buffer to be little endian, but ma_format_s16 is native endian, so we need to do some conversion
-		convertLittleEndianBufferToNativeEndianU16(inMemoryBuffer, uiBufferSize);
-	}
-
-	SAMPLETAG* s = SoundLoadBuffer(inMemoryBuffer, uiBufferSize, format, channels, rate);
+	SAMPLETAG* s = SoundLoadBuffer(NULL, 0, format, channels, rate);
 	if (s == NULL) return SOUND_ERROR;
 
+	s->pStream         = new SOUNDSTREAM{};
 	s->pName           = name;
 	s->uiPanMax        = 64;
 	s->uiMaxInstances  = 1;
@@ -272,7 +279,57 @@ UINT32 SoundPlayFromSmackBuff(const char* name, UINT8 channels, UINT8 depth, UIN
 	SOUNDTAG* const channel = SoundGetFreeChannel();
 	if (channel == NULL) return SOUND_ERROR;
 
-	return SoundStartSample(s, channel, volume, pan, loop, end_callback, data);
+	return SoundStartSample(s, channel, volume, pan, 1, end_callback, data);
+}
+
+
+static SOUNDTAG* SoundGetChannelByID(UINT32 uiSoundID);
+
+
+// Returns the sample of a streamed sound or NULL if there is none
+static SAMPLETAG* SoundGetStreamedSample(UINT32 uiSoundID)
+{
+	if (!fSoundSystemInit) return NULL;
+
+	const SOUNDTAG* const channel = SoundGetChannelByID(uiSoundID);
+	if (channel == NULL || channel->pSample == NULL) return NULL;
+	if (channel->pSample->pStream == NULL) return NULL;
+
+	return channel->pSample;
+}
+
+
+BOOLEAN SoundStreamQueue(UINT32 uiSoundID, const UINT8* buf, UINT32 size)
+{
+	const SAMPLETAG* const s = SoundGetStreamedSample(uiSoundID);
+	if (s == NULL) return FALSE;
+
+	SOUNDSTREAM* const stream = s->pStream;
+	std::lock_guard<std::mutex> lk(stream->mutex);
+	if (stream->fEnded) return FALSE;
+
+	// Drop what the buffer service thread already consumed before growing
+	stream->data.erase(stream->data.begin(), stream->data.begin() + stream->uiReadPos);
+	stream->uiReadPos = 0;
+
+	const size_t offset = stream->data.size();
+	stream->data.insert(stream->data.end(), buf, buf + size);
+	if (s->eInMemoryFormat == ma_format_s16) {
+		// We expect the Endianess for the Smacker buffer to be little endian, but ma_format_s16 is native endian, so we need to do some conversion
+		convertLittleEndianBufferToNativeEndianU16(stream->data.data() + offset, size);
+	}
+	return TRUE;
+}
+
+
+BOOLEAN SoundStreamEnd(UINT32 uiSoundID)
+{
+	const SAMPLETAG* const s = SoundGetStreamedSample(uiSoundID);
+	if (s == NULL) return FALSE;
+
+	std::lock_guard<std::mutex> lk(s->pStream->mutex);
+	s->pStream->fEnded = TRUE;
+	return TRUE;
 }
 
 
@@ -297,15 +354,12 @@ UINT32 SoundPlayRandom(const char* pFilename, UINT32 time_min, UINT32 time_max,
 	s->uiTimeNext =
 		GetClock() +
 		s->uiTimeMin +
-		Random(s->uiTimeMax - s->uiTimeMin);
+		Random(RNG_SOUND, s->uiTimeMax - s->uiTimeMin);
 
 	return (UINT32)(s - pSampleList);
 }
 
 
-static SOUNDTAG* SoundGetChannelByID(UINT32 uiSoundID);
-
-
 BOOLEAN SoundIsPlaying(UINT32 uiSoundID)
 {
 	if (!fSoundSystemInit) return FALSE;
@@ -419,8 +473,8 @@ static UINT32 SoundStartRandom(SAMPLETAG* s)
 	SOUNDTAG* const channel = SoundGetFreeChannel();
 	if (channel == NULL) return NO_SAMPLE;
 
-	const UINT32 volume = s->uiVolMin + Random(s->uiVolMax - s->uiVolMin);
-	const UINT32 pan    = s->uiPanMin + Random(s->uiPanMax - s->uiPanMin);
+	const UINT32 volume = s->uiVolMin + Random(RNG_SOUND, s->uiVolMax - s->uiVolMin);
+	const UINT32 pan    = s->uiPanMin + Random(RNG_SOUND, s->uiPanMax - s->uiPanMin);
 
 	const UINT32 uiSoundID = SoundStartSample(s, channel, volume, pan, 1, NULL, NULL);
 	if (uiSoundID == SOUND_ERROR) return NO_SAMPLE;
@@ -428,7 +482,7 @@ static UINT32 SoundStartRandom(SAMPLETAG* s)
 	s->uiTimeNext =
 		GetClock() +
 		s->uiTimeMin +
-		Random(s->uiTimeMax - s->uiTimeMin);
+		Random(RNG_SOUND, s->uiTimeMax - s->uiTimeMin);
 	return uiSoundID;
 }
 
@@ -470,6 +524,31 @@ void maResultToRuntimeError(ma_result result, const char* functionName) {
 		}
 }
 
+/* Converts as much of the queued data of a streamed sample as fits into
+ * pFramesOut.
+ *
+ * Returns: The number of frames written. drained is set when the producer
+ *          ended the stream and everything has been consumed. */
+static ma_uint64 ReadSoundStream(SAMPLETAG* sample, void* pFramesOut, ma_uint64 frameCount, BOOLEAN* drained) {
+	SOUNDSTREAM* const stream = sample->pStream;
+	std::lock_guard<std::mutex> lk(stream->mutex);
+
+	auto bytesPerFrame = ma_get_bytes_per_frame(sample->eInMemoryFormat, sample->uiInMemoryChannels);
+	ma_uint64 inputFrames = (stream->data.size() - stream->uiReadPos) / bytesPerFrame;
+	ma_uint64 outputFrames = frameCount;
+	maResultToRuntimeError(ma_data_converter_process_pcm_frames(
+		sample->pDataConverter,
+		stream->data.data() + stream->uiReadPos,
+		&inputFrames,
+		pFramesOut,
+		&outputFrames
+	), "ma_data_converter_process_pcm_frames");
+	stream->uiReadPos += inputFrames * bytesPerFrame;
+
+	*drained = stream->fEnded && stream->data.size() - stream->uiReadPos < bytesPerFrame;
+	return outputFrames;
+}
+
 static void FillRingBuffer(SOUNDTAG* channel) {
 	auto sample = channel->pSample;
 
@@ -482,7 +561,11 @@ static void FillRingBuffer(SOUNDTAG* channel) {
 		void* pFramesInClientFormat;
 		maResultToRuntimeError(ma_pcm_rb_acquire_write(channel->pRingBuffer, &bytesToWrite, &pFramesInClientFormat), "ma_pcm_rb_acquire_write");
 		ma_uint64 framesRead = 0;
-		if (sample->pDecoder != NULL) {
+		BOOLEAN streamDrained = FALSE;
+		if (sample->pStream != NULL) {
+			// We stream from the data queued by the producer
+			framesRead = ReadSoundStream(sample, pFramesInClientFormat, bytesToWrite, &streamDrained);
+		} else if (sample->pDecoder != NULL) {
 			maResultToRuntimeError(ma_decoder_seek_to_pcm_frame(sample->pDecoder, channel->Pos), "ma_decoder_seek_to_pcm_frame");
 			// We stream from file
 			auto result = ma_decoder_read_pcm_frames(sample->pDecoder, pFramesInClientFormat, bytesToWrite, &framesRead);
@@ -518,7 +601,10 @@ static void FillRingBuffer(SOUNDTAG* channel) {
 		maResultToRuntimeError(ma_pcm_rb_commit_write(channel->pRingBuffer, framesRead), "ma_pcm_rb_commit_write");
 
 		channel->Pos += framesRead;
-		if (framesRead < bytesToWrite) {
+		if (sample->pStream != NULL) {
+			// Running dry only ends a stream once the producer is done with it
+			if (streamDrained) channel->DoneServicing = TRUE;
+		} else if (framesRead < bytesToWrite) {
 			// If the sound is looped, continue to fill buffer in the next iteration
 			if (channel->Loops > 1) {
 				channel->Loops -= 1;
@@ -876,6 +962,7 @@ static void SoundFreeSample(SAMPLETAG* s)
 	if (s->pInMemoryBuffer != NULL) {
 		delete[] s->pInMemoryBuffer;
 	}
+	delete s->pStream;
 	*s = SAMPLETAG{};
 }
 
@@ -947,7 +1034,9 @@ static void SoundCallback(void* userdata, Uint8* stream, int len)
 				}
 
 				rbResult = ma_pcm_rb_commit_read(Sound->pRingBuffer, samples);
-				if (samples < want_samples || rbResult == MA_AT_END) {
+				// A stream waiting for its producer underruns instead of ending
+				const BOOLEAN ended = Sound->pSample->pStream == NULL || Sound->DoneServicing;
+				if ((samples < want_samples && ended) || rbResult == MA_AT_END) {
 					Sound->State = CHANNEL_DEAD;
 				}
 
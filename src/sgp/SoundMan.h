@@ -22,7 +22,19 @@ void InitializeSoundManager(void);
 void ShutdownSoundManager(void);
 
 
-UINT32 SoundPlayFromSmackBuff(const char* name, UINT8 channels, UINT8 depth, UINT32 rate, std::vector<UINT8>& buf, UINT32 volume, UINT32 pan, UINT32 loop, void (*end_callback)(void*), void* data);
+/* Starts a sample that is fed while it is playing, e.g. the audio track of a
+ * Smacker flic. The raw PCM data is handed over in chunks with
+ * SoundStreamQueue(), SoundStreamEnd() tells that no more data follows. The
+ * sample underruns with silence while nothing is queued.
+ *
+ * Returns: A sound ID unique to that instance of the sound or SOUND_ERROR. */
+UINT32 SoundPlayStreamed(const char* name, UINT8 channels, UINT8 depth, UINT32 rate, UINT32 volume, UINT32 pan, void (*end_callback)(void*), void* data);
+
+// Appends raw PCM data to a streamed sample
+BOOLEAN SoundStreamQueue(UINT32 uiSoundID, const UINT8* buf, UINT32 size);
+
+// Marks the end of a streamed sample, it stops once the queued data is played
+BOOLEAN SoundStreamEnd(UINT32 uiSoundID);
 
 
 /* Starts a sample playing. If the sample is not loaded in the cache, it will
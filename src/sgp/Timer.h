@@ -1,12 +1,14 @@
 #ifndef TIMER_H
 #define TIMER_H
 
+#include "InputRecorder.h"
 #include "Types.h"
 #include <SDL.h>
 
+// Follows the recorded time while an input recording is replayed
 static inline UINT32 GetClock(void)
 {
-	return SDL_GetTicks();
+	return InputRecorder::GetTicks();
 }
 
 #endif
@@ -55,6 +55,7 @@ static SDL_Renderer*  GameRenderer;
 SDL_Window* g_game_window;
 
 static SDL_Surface* ScreenBuffer;
+static SDL_Surface* ScrollBuffer; // Scratch copy of the viewport while scrolling
 static SDL_Texture* ScreenTexture;
 static SDL_Texture* ScaledScreenTexture;
 static Uint32       g_window_flags = 0;
@@ -162,6 +163,21 @@ void InitializeVideoManager(const VideoScaleQuality quality,
 		SLOGE("SDL_CreateRGBSurface for ScreenBuffer failed: {}\n", SDL_GetError());
 	}
 
+	ScrollBuffer = SDL_CreateRGBSurface(
+					0,
+					SCREEN_WIDTH,
+					SCREEN_HEIGHT,
+					PIXEL_DEPTH,
+					RED_MASK,
+					GREEN_MASK,
+					BLUE_MASK,
+					ALPHA_MASK
+	);
+
+	if (ScrollBuffer == NULL) {
+		SLOGE("SDL_CreateRGBSurface for ScrollBuffer failed: {}\n", SDL_GetError());
+	}
+
 
 	if (ScaleQuality == VideoScaleQuality::PERFECT)
 	{
@@ -247,6 +263,11 @@ void ShutdownVideoManager(void)
 	// ScreenBuffer SDL surface freed by its SGPVSurface wrapper.
 	ScreenBuffer = nullptr;
 
+	if (ScrollBuffer != NULL) {
+		SDL_FreeSurface(ScrollBuffer);
+		ScrollBuffer = NULL;
+	}
+
 	if (ScreenTexture != NULL) {
 		SDL_DestroyTexture(ScreenTexture);
 		ScreenTexture = NULL;
@@ -445,11 +466,12 @@ static void ScrollJA2Background(INT16 sScrollXIncrement, INT16 sScrollYIncrement
 	SDL_FillRect(Dest, NULL, 0);
 #endif
 
+	// Source and destination overlap, so the part that stays visible goes
+	// through the scroll buffer
 	{
-		SurfaceUniquePtr Source(SDL_CreateRGBSurfaceWithFormat(0,
-			ScreenBuffer->w, ScreenBuffer->h, 0, ScreenBuffer->format->format));
-		SDL_BlitSurface(ScreenBuffer, nullptr, Source.get(), nullptr);
-		SDL_BlitSurface(Source.get(), &SrcRect, Dest, &DstRect);
+		SDL_Rect Rect = SrcRect;
+		SDL_BlitSurface(ScreenBuffer, &SrcRect, ScrollBuffer, &Rect);
+		SDL_BlitSurface(ScrollBuffer, &Rect, Dest, &DstRect);
 	}
 
 	for (UINT i = 0; i < NumStrips; i++)
@@ -477,6 +499,85 @@ static void ScrollJA2Background(INT16 sScrollXIncrement, INT16 sScrollYIncrement
 	ExecuteVideoOverlaysToAlternateBuffer(BACKBUFFER);
 }
 
+static int RectArea(SDL_Rect const& r)
+{
+	return r.w * r.h;
+}
+
+
+/* Merges rectangles whose bounding rectangle is exactly the pixels they cover
+ * together, e.g. adjacent rectangles of the same height or rectangles lying
+ * inside each other. This way fewer, larger rectangles are copied and no clean
+ * pixel is copied needlessly.
+ *
+ * Returns: The number of rectangles left. */
+static UINT32 CoalesceRegions(SDL_Rect* const regions, UINT32 n)
+{
+	bool merged;
+	do
+	{
+		merged = false;
+		for (UINT32 i = 0; i < n; ++i)
+		{
+			for (UINT32 j = i + 1; j < n;)
+			{
+				SDL_Rect const& a = regions[i];
+				SDL_Rect const& b = regions[j];
+				SDL_Rect u;
+				SDL_Rect overlap;
+				SDL_UnionRect(&a, &b, &u);
+				int const overlap_area = SDL_IntersectRect(&a, &b, &overlap) ? RectArea(overlap) : 0;
+				if (RectArea(u) != RectArea(a) + RectArea(b) - overlap_area)
+				{
+					++j;
+					continue;
+				}
+				regions[i] = u;
+				regions[j] = regions[--n];
+				merged = true;
+			}
+		}
+	}
+	while (merged);
+	return n;
+}
+
+
+/* Uploads the given regions of the screen buffer to the screen texture. When
+ * the regions are spread out thinly they are uploaded one by one, otherwise
+ * their bounding rectangle is uploaded in one go. */
+static void UpdateScreenTexture(SDL_Rect const* const regions, UINT32 const n)
+{
+	if (n == 0) return;
+
+	SDL_Rect bounds = regions[0];
+	int      area   = 0;
+	for (UINT32 i = 0; i < n; ++i)
+	{
+		SDL_UnionRect(&bounds, &regions[i], &bounds);
+		area += RectArea(regions[i]);
+	}
+
+	UINT32          count = n;
+	SDL_Rect const* rects = regions;
+	if (RectArea(bounds) <= 2 * area)
+	{
+		count = 1;
+		rects = &bounds;
+	}
+
+	for (UINT32 i = 0; i < count; ++i)
+	{
+		SDL_Rect const& r = rects[i];
+		if (SDL_RectEmpty(&r)) continue;
+		uint8_t const * SrcPixels = static_cast<uint8_t *>(ScreenBuffer->pixels)
+			+ r.y * ScreenBuffer->pitch
+			+ r.x * ScreenBuffer->format->BytesPerPixel;
+		SDL_UpdateTexture(ScreenTexture, &r, SrcPixels, ScreenBuffer->pitch);
+	}
+}
+
+
 void RefreshScreen(void)
 {
 	// Not initialised yet or already shut down?
@@ -493,10 +594,11 @@ void RefreshScreen(void)
 
 	SDL_BlitSurface(FrameBuffer, &MouseBackground, ScreenBuffer, &MouseBackground);
 
-	// This variable will hold the union of all modified regions.
-	struct rect : SDL_Rect {
-		void operator+=(SDL_Rect const& r) { SDL_UnionRect(this, &r, this); }
-	} ScreenTextureUpdateRect{ MouseBackground };
+	// The modified regions, these are copied from the frame buffer and
+	// uploaded to the screen texture
+	SDL_Rect Regions[2 * MAX_DIRTY_REGIONS + 3];
+	UINT32   NumRegions = 0;
+	Regions[NumRegions++] = MouseBackground;
 
 	if (gfForceFullScreenRefresh || guiDirtyRegionCount > 0 || guiDirtyRegionExCount > 0)
 	{
@@ -509,14 +611,15 @@ void RefreshScreen(void)
 			if (gfForceFullScreenRefresh)
 			{
 				SDL_BlitSurface(FrameBuffer, NULL, ScreenBuffer, NULL);
-				ScreenTextureUpdateRect = { 0, 0, ScreenBuffer->w, ScreenBuffer->h };
+				Regions[0] = { 0, 0, ScreenBuffer->w, ScreenBuffer->h };
+				NumRegions = 1;
 			}
 			else
 			{
+				UINT32 const first = NumRegions;
 				for (UINT32 i = 0; i < guiDirtyRegionCount; i++)
 				{
-					ScreenTextureUpdateRect += DirtyRegions[i];
-					SDL_BlitSurface(FrameBuffer, &DirtyRegions[i], ScreenBuffer, &DirtyRegions[i]);
+					Regions[NumRegions++] = DirtyRegions[i];
 				}
 
 				for (UINT32 i = 0; i < guiDirtyRegionExCount; i++)
@@ -530,8 +633,14 @@ void RefreshScreen(void)
 							continue;
 						}
 					}
-					ScreenTextureUpdateRect += *r;
-					SDL_BlitSurface(FrameBuffer, r, ScreenBuffer, r);
+					Regions[NumRegions++] = *r;
+				}
+
+				// Overlapping regions are copied only once
+				NumRegions = first + CoalesceRegions(Regions + first, NumRegions - first);
+				for (UINT32 i = first; i < NumRegions; i++)
+				{
+					SDL_BlitSurface(FrameBuffer, &Regions[i], ScreenBuffer, &Regions[i]);
 				}
 			}
 		}
@@ -540,7 +649,7 @@ void RefreshScreen(void)
 			ScrollJA2Background(gsScrollXIncrement, gsScrollYIncrement);
 			gsScrollXIncrement = 0;
 			gsScrollYIncrement = 0;
-			ScreenTextureUpdateRect += SDL_Rect{
+			Regions[NumRegions++] = SDL_Rect{
 				gsVIEWPORT_START_X, gsVIEWPORT_WINDOW_START_Y,
 				gsVIEWPORT_END_X - gsVIEWPORT_START_X,
 				gsVIEWPORT_WINDOW_END_Y - gsVIEWPORT_WINDOW_START_Y };
@@ -558,14 +667,11 @@ void RefreshScreen(void)
 	dst.x = cursorPos.iX - gsMouseCursorXOffset;
 	dst.y = cursorPos.iY - gsMouseCursorYOffset;
 	SDL_BlitSurface(MouseCursor, &src, ScreenBuffer, &dst);
-	ScreenTextureUpdateRect += dst;
+	Regions[NumRegions++] = dst;
 	MouseBackground = dst;
 
-	uint8_t const * SrcPixels = static_cast<uint8_t *>(ScreenBuffer->pixels)
-		+ ScreenTextureUpdateRect.y * ScreenBuffer->pitch
-		+ ScreenTextureUpdateRect.x * ScreenBuffer->format->BytesPerPixel;
-	SDL_UpdateTexture(ScreenTexture, &ScreenTextureUpdateRect,
-	                  SrcPixels, ScreenBuffer->pitch);
+	NumRegions = CoalesceRegions(Regions, NumRegions);
+	UpdateScreenTexture(Regions, NumRegions);
 
 	if (ScaleQuality == VideoScaleQuality::NEAR_PERFECT) {
 		SDL_SetRenderTarget(GameRenderer, ScaledScreenTexture);